@@ -0,0 +1,692 @@
+#include "Rate_Floorlet.h"
+#include "Rate_Cap_Floor.h"
+#include "Rate_Cap.h" // includes Rate_Caplet.h
+#include "Term_Structure.h"
+#include "Bond.h"
+#include "Batch_Validation.h"
+#include "Bond_Book.h"
+#include "Cap_Floor_Book.h"
+#include "Optionlet_Batch.h"
+#include "Pricing_Workspace.h"
+#include "Mixed_Precision.h"
+#include "Implied_Volatility.h"
+#include "Libor_Market_Model.h"
+#include "Vol_Calibration.h"
+#include "Sabr_Calibration.h"
+#include "Swaption_Grid.h"
+#include "Yield_Solver.h"
+#include "Black_Simd.h"
+#include "Thread_Pool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <random>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+/**
+* Project:    Project 1
+* Filename:   Benchmarks.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Microbenchmark and throughput suite for every pricing path.
+*
+* Usage: benchmarks [--quick] [--sizes 64,4096] [--threads 1,4] [--filter text] [--min-time seconds]
+*                   [--output results.csv] [--baseline previous.csv] [--tolerance 0.1]
+* Every benchmark runs a book of N independent items split across T threads and reports ns/op, ops/s and
+* heap allocations per op. Results are written as CSV; with --baseline, the run is compared against a previous
+* CSV and the exit code is 1 if any benchmark got slower by more than the tolerance.
+*/
+
+
+namespace
+{
+	std::atomic<unsigned long long> allocation_count{ 0 };
+	std::atomic<double> benchmark_sink{ 0 }; // keeps results alive so the work is not optimised away
+
+	struct Bench_Result
+	{
+		std::string name;
+		std::size_t book_size;
+		unsigned int threads;
+		double ns_per_op;
+		double ops_per_s;
+		double allocs_per_op;
+	};
+
+	struct Options
+	{
+		std::vector<std::size_t> sizes{ 64, 4096, 65536 };
+		std::vector<unsigned int> threads;
+		std::string filter;
+		double min_time{ 0.2 };
+		std::string output{ "bench_results.csv" };
+		std::string baseline;
+		double tolerance{ 0.1 };
+	};
+
+	/**
+	* Caplet exposing the protected pricing and inversion methods of Rate_Derivative.
+	*/
+	class Caplet_Probe : public Rate_Caplet
+	{
+	public:
+		using Rate_Caplet::Rate_Caplet;
+		double price_at(const double& vol) { return analytic_price(vol); };
+		void infer(const double& option_price) { determine_volatility(option_price, true); };
+	};
+
+	class Floorlet_Probe : public Rate_Floorlet
+	{
+	public:
+		using Rate_Floorlet::Rate_Floorlet;
+		double price_at(const double& vol) { return analytic_price(vol); };
+	};
+
+	/**
+	* Stream buffer discarding everything, used to silence Bond::get_ytm.
+	*/
+	class Null_Buffer : public std::streambuf
+	{
+	protected:
+		int overflow(int c) { return c; };
+		std::streamsize xsputn(const char*, std::streamsize n) { return n; };
+	};
+
+	/**
+	* Inputs of a book of N optionlets and N coupon bonds.
+	*/
+	struct Book
+	{
+		std::vector<double> strikes, vols, rate_1, rate_2, t_1_days, forwards, expiries, discounts, caplet_prices;
+		std::vector<unsigned int> t_1, t_2;
+		std::vector<Caplet_Probe> caplets;
+		std::vector<Floorlet_Probe> floorlets;
+		std::vector<Bond> bonds;
+		std::vector<float> bond_rates;
+		std::vector<double> bond_prices;
+		std::vector<float> strikes_f, vols_f, forwards_f, t_1_f, discounts_f; // single precision copies (Mixed_Precision)
+		std::vector<float> amounts_f, cashflow_rates_f, times_f;
+		Bond_Book bond_book;
+		Discount_Curve curve;
+	};
+
+	std::unique_ptr<Book> make_book(const std::size_t& n)
+	{
+		std::unique_ptr<Book> book(new Book());
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<double> uniform(0., 1.);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			unsigned int start = 30 + unsigned(uniform(generator) * 1800);
+			book->strikes.push_back(0.03 + 0.06 * uniform(generator));
+			book->vols.push_back(0.1 + 0.3 * uniform(generator));
+			book->rate_1.push_back(0.03 + 0.05 * uniform(generator));
+			book->rate_2.push_back(book->rate_1.back() + 0.002 * uniform(generator));
+			book->t_1.push_back(start);
+			book->t_2.push_back(start + 91);
+
+			book->caplets.emplace_back(book->strikes[i], book->vols[i], book->rate_1[i], book->t_1[i], book->rate_2[i], book->t_2[i], true);
+			book->floorlets.emplace_back(book->strikes[i], book->vols[i], book->rate_1[i], book->t_1[i], book->rate_2[i], book->t_2[i], true);
+			book->caplet_prices.push_back(book->caplets.back().get_price());
+			book->forwards.push_back(book->caplets.back().get_fwd_rate());
+			book->t_1_days.push_back(book->t_1[i]);
+			book->discounts.push_back(exp(-book->rate_2[i] * book->t_2[i] / 365.));
+		}
+
+		// Ten semi-annual coupons per bond, priced off a shared set of rates
+		std::vector<unsigned int> dates;
+		for (unsigned int j = 1; j <= 10; j++)
+		{
+			dates.push_back(182 * j);
+			book->bond_rates.push_back(float(0.03 + 0.004 * j));
+		}
+		for (std::size_t i = 0; i < n; i++)
+		{
+			std::vector<float> coupons(10, float(1 + 4 * uniform(generator)));
+			book->bonds.push_back(Bond(coupons, dates, 100.f, dates.back()));
+			book->bond_prices.push_back(book->bonds.back().get_price(book->bond_rates, dates.back()));
+			book->bond_book.add_bond(book->bonds.back());
+		}
+		std::vector<double> curve_rates(book->bond_rates.begin(), book->bond_rates.end());
+		book->curve = Discount_Curve(curve_rates, dates);
+
+		for (auto p : { std::make_pair(&book->strikes, &book->strikes_f), std::make_pair(&book->vols, &book->vols_f), std::make_pair(&book->forwards, &book->forwards_f),
+			std::make_pair(&book->t_1_days, &book->t_1_f), std::make_pair(&book->discounts, &book->discounts_f) })
+		{
+			p.second->resize(n);
+			Mixed_Precision::to_float(p.first->data(), p.second->data(), n);
+		}
+		for (std::size_t c = 0; c < book->bond_book.get_cashflow_count(); c++)
+		{
+			book->amounts_f.push_back(float(book->bond_book.get_amounts()[c]));
+			book->times_f.push_back(float(book->bond_book.get_times()[c]));
+			book->cashflow_rates_f.push_back(book->bond_rates[c % 10]);
+		}
+		return book;
+	}
+
+	/**
+	* Function to time one benchmark: call runs the whole book once, and is repeated until min_time has elapsed.
+	*/
+	Bench_Result measure(const std::string& name, const std::size_t& n, const unsigned int& threads, const double& min_time, const std::function<void()>& call)
+	{
+		call(); // warm up caches, the pool and any lazily sized buffers
+
+		unsigned long long allocations_before = allocation_count.load();
+		std::size_t repetitions = 0;
+		auto start = std::chrono::steady_clock::now();
+		double elapsed = 0;
+		do
+		{
+			call();
+			repetitions++;
+			elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		} while (elapsed < min_time);
+		unsigned long long allocations = allocation_count.load() - allocations_before;
+
+		double ops = double(n) * repetitions;
+		return Bench_Result{ name, n, threads, elapsed * 1e9 / ops, ops / elapsed, allocations / ops };
+	}
+
+	std::vector<std::size_t> parse_list(const std::string& text)
+	{
+		std::vector<std::size_t> values;
+		std::stringstream stream(text);
+		std::string item;
+		while (std::getline(stream, item, ','))
+		{
+			values.push_back(std::stoul(item));
+		}
+		return values;
+	}
+
+	Options parse_options(int argc, char** argv)
+	{
+		Options options;
+		for (int i = 1; i < argc; i++)
+		{
+			std::string arg = argv[i];
+			std::string value = i + 1 < argc ? argv[i + 1] : "";
+			if (arg == "--quick")
+			{
+				options.sizes = { 64, 1024 };
+				options.min_time = 0.02;
+				continue;
+			}
+			if (arg == "--sizes") options.sizes = parse_list(value);
+			else if (arg == "--threads") { for (auto &t : parse_list(value)) options.threads.push_back(unsigned(t)); }
+			else if (arg == "--filter") options.filter = value;
+			else if (arg == "--min-time") options.min_time = std::stod(value);
+			else if (arg == "--output") options.output = value;
+			else if (arg == "--baseline") options.baseline = value;
+			else if (arg == "--tolerance") options.tolerance = std::stod(value);
+			else {
+				std::cerr << "Unknown option " << arg << std::endl;
+				std::exit(2);
+			}
+			i++;
+		}
+
+		if (options.threads.empty())
+		{
+			unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+			for (unsigned int t = 1; t < hardware; t *= 4)
+			{
+				options.threads.push_back(t);
+			}
+			options.threads.push_back(hardware);
+		}
+		return options;
+	}
+
+	/**
+	* Function to compare results against a previous CSV, returns the number of regressions.
+	*/
+	int compare_with_baseline(const std::vector<Bench_Result>& results, const std::string& path, const double& tolerance)
+	{
+		std::ifstream in(path);
+		if (!in)
+		{
+			std::cerr << "Baseline " << path << " could not be read." << std::endl;
+			return 1;
+		}
+
+		std::map<std::string, double> baseline;
+		std::string line;
+		std::getline(in, line); // header
+		while (std::getline(in, line))
+		{
+			std::stringstream stream(line);
+			std::string name, size, threads, ns;
+			std::getline(stream, name, ',');
+			std::getline(stream, size, ',');
+			std::getline(stream, threads, ',');
+			std::getline(stream, ns, ',');
+			baseline[name + "|" + size + "|" + threads] = std::stod(ns);
+		}
+
+		int regressions = 0;
+		std::cout << "\nComparison with " << path << " (ratio = new / old ns per op)" << std::endl;
+		for (auto &r : results)
+		{
+			auto found = baseline.find(r.name + "|" + std::to_string(r.book_size) + "|" + std::to_string(r.threads));
+			if (found == baseline.end())
+			{
+				continue;
+			}
+			double ratio = r.ns_per_op / found->second;
+			bool regressed = ratio > 1 + tolerance;
+			regressions += regressed;
+			std::cout << std::left << std::setw(36) << r.name << std::right << std::setw(9) << r.book_size << std::setw(4) << r.threads
+				<< std::setw(10) << std::fixed << std::setprecision(3) << ratio << (regressed ? "  REGRESSION" : "") << std::endl;
+		}
+		return regressions;
+	}
+}
+
+
+// Count every heap allocation made by the process
+void* operator new(std::size_t size)
+{
+	allocation_count.fetch_add(1, std::memory_order_relaxed);
+	void* p = std::malloc(size ? size : 1);
+	if (!p)
+	{
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+
+int main(int argc, char** argv)
+{
+	Options options = parse_options(argc, argv);
+	std::vector<Bench_Result> results;
+	Null_Buffer null_buffer;
+
+	std::cout << "Instruction set: " << Black_Simd::get_instruction_set_name(Black_Simd::get_instruction_set()) << std::endl;
+	std::cout << std::left << std::setw(36) << "benchmark" << std::right << std::setw(9) << "N" << std::setw(4) << "T"
+		<< std::setw(12) << "ns/op" << std::setw(14) << "ops/s" << std::setw(12) << "allocs/op" << std::endl;
+
+	for (auto &n : options.sizes)
+	{
+		std::unique_ptr<Book> book = make_book(n);
+		Book& b = *book;
+		std::vector<double> output(n);
+		std::vector<double> output_2(n), output_3(n), output_4(n);
+		std::vector<double> forwards(n), expiries(n), discounts(n);
+		std::vector<Input_Status> input_status(n);
+		std::vector<float> output_f(10 * n);
+		std::vector<Vol_Result> vol_results(n);
+		std::vector<Yield_Result> yield_results(n);
+
+		for (auto &t : options.threads)
+		{
+			Thread_Pool pool(t);
+			std::size_t first_result = results.size();
+
+			// Benchmarks over the items of the book, split across the pool
+			std::vector<std::pair<std::string, std::function<void(std::size_t, std::size_t)>>> per_item;
+			per_item.emplace_back("Rate_Caplet construction", [&](std::size_t begin, std::size_t end)
+			{
+				double sum = 0;
+				for (std::size_t i = begin; i < end; i++)
+				{
+					Rate_Caplet c(b.strikes[i], b.vols[i], b.rate_1[i], b.t_1[i], b.rate_2[i], b.t_2[i], true);
+					sum += c.get_price();
+				}
+				benchmark_sink.store(sum, std::memory_order_relaxed);
+			});
+			per_item.emplace_back("Rate_Floorlet construction", [&](std::size_t begin, std::size_t end)
+			{
+				double sum = 0;
+				for (std::size_t i = begin; i < end; i++)
+				{
+					Rate_Floorlet f(b.strikes[i], b.vols[i], b.rate_1[i], b.t_1[i], b.rate_2[i], b.t_2[i], true);
+					sum += f.get_price();
+				}
+				benchmark_sink.store(sum, std::memory_order_relaxed);
+			});
+			per_item.emplace_back("Rate_Caplet analytic_price", [&](std::size_t begin, std::size_t end)
+			{
+				double sum = 0;
+				for (std::size_t i = begin; i < end; i++)
+				{
+					sum += b.caplets[i].price_at(b.vols[i]);
+				}
+				benchmark_sink.store(sum, std::memory_order_relaxed);
+			});
+			per_item.emplace_back("Rate_Floorlet analytic_price", [&](std::size_t begin, std::size_t end)
+			{
+				double sum = 0;
+				for (std::size_t i = begin; i < end; i++)
+				{
+					sum += b.floorlets[i].price_at(b.vols[i]);
+				}
+				benchmark_sink.store(sum, std::memory_order_relaxed);
+			});
+			per_item.emplace_back("determine_volatility", [&](std::size_t begin, std::size_t end)
+			{
+				double sum = 0;
+				for (std::size_t i = begin; i < end; i++)
+				{
+					b.caplets[i].infer(b.caplet_prices[i]);
+					sum += b.caplets[i].get_volatility();
+				}
+				benchmark_sink.store(sum, std::memory_order_relaxed);
+			});
+			per_item.emplace_back("Term_Structure forward rates", [&](std::size_t begin, std::size_t end)
+			{
+				double sum = 0;
+				for (std::size_t i = begin; i < end; i++)
+				{
+					Term_Structure ts(b.rate_1[i], b.t_1[i], b.rate_2[i], b.t_2[i]);
+					sum += ts.get_continuous_fwd_rate() + ts.get_discrete_fwd_rate();
+				}
+				benchmark_sink.store(sum, std::memory_order_relaxed);
+			});
+			per_item.emplace_back("Bond::get_price", [&](std::size_t begin, std::size_t end)
+			{
+				double sum = 0;
+				for (std::size_t i = begin; i < end; i++)
+				{
+					sum += b.bonds[i].get_price(b.bond_rates, 1820);
+				}
+				benchmark_sink.store(sum, std::memory_order_relaxed);
+			});
+			per_item.emplace_back("Bond::get_ytm", [&](std::size_t begin, std::size_t end)
+			{
+				double sum = 0;
+				for (std::size_t i = begin; i < end; i++)
+				{
+					sum += b.bonds[i].get_ytm();
+				}
+				benchmark_sink.store(sum, std::memory_order_relaxed);
+			});
+			per_item.emplace_back("Implied_Volatility::solve", [&](std::size_t begin, std::size_t end)
+			{
+				for (std::size_t i = begin; i < end; i++)
+				{
+					vol_results[i] = Implied_Volatility::solve(b.caplet_prices[i], b.forwards[i], b.strikes[i], b.t_1_days[i], b.discounts[i], true);
+				}
+			});
+			per_item.emplace_back("Optionlet_Batch caplet kernel", [&](std::size_t begin, std::size_t end)
+			{
+				Optionlet_Batch::caplet_prices(&b.strikes[begin], &b.vols[begin], &b.forwards[begin], &b.t_1_days[begin], &b.discounts[begin], &output[begin], end - begin);
+			});
+			per_item.emplace_back("Mixed_Precision caplet kernel", [&](std::size_t begin, std::size_t end)
+			{
+				Black_Simd::caplet_prices(&b.strikes_f[begin], &b.vols_f[begin], &b.forwards_f[begin], &b.t_1_f[begin], &b.discounts_f[begin], &output_f[begin], end - begin);
+			});
+			per_item.emplace_back("Mixed_Precision::cap_total", [&](std::size_t begin, std::size_t end)
+			{
+				Mixed_Total cap = Mixed_Precision::cap_total(&b.strikes_f[begin], &b.vols_f[begin], &b.forwards_f[begin], &b.t_1_f[begin], &b.discounts_f[begin], end - begin, &output_f[begin]);
+				benchmark_sink.store(cap.total, std::memory_order_relaxed);
+			});
+			per_item.emplace_back("Mixed_Precision::cap_total refined", [&](std::size_t begin, std::size_t end)
+			{
+				Mixed_Total cap = Mixed_Precision::cap_total(&b.strikes_f[begin], &b.vols_f[begin], &b.forwards_f[begin], &b.t_1_f[begin], &b.discounts_f[begin], end - begin, &output_f[begin], 1e-9 * double(end - begin));
+				benchmark_sink.store(cap.total, std::memory_order_relaxed);
+			});
+			per_item.emplace_back("Mixed_Precision::bond_prices", [&](std::size_t begin, std::size_t end)
+			{
+				const std::size_t* offsets = b.bond_book.get_offsets().data();
+				Mixed_Total bonds = Mixed_Precision::bond_prices(b.amounts_f.data(), b.cashflow_rates_f.data(), b.times_f.data(), offsets + begin, end - begin, output_f.data(), &output[begin]);
+				benchmark_sink.store(bonds.total, std::memory_order_relaxed);
+			});
+			per_item.emplace_back("Rate_Cap_Floor fused kernel", [&](std::size_t begin, std::size_t end)
+			{
+				Optionlet_Batch::optionlet_values(&b.strikes[begin], &b.vols[begin], &b.forwards[begin], &b.t_1_days[begin], &b.discounts[begin], &output[begin], &output_2[begin], &output_3[begin], &output_4[begin], end - begin);
+			});
+			per_item.emplace_back("Batch_Validation::price_optionlets", [&](std::size_t begin, std::size_t end)
+			{
+				Batch_Validation::price_optionlets(&b.strikes[begin], &b.vols[begin], &b.rate_1[begin], &b.t_1[begin], &b.rate_2[begin], &b.t_2[begin], end - begin, true, &input_status[begin],
+					&forwards[begin], &expiries[begin], &discounts[begin], &output[begin], &output_2[begin], &output_3[begin], &output_4[begin]);
+			});
+
+			for (auto &bench : per_item)
+			{
+				if (bench.first.find(options.filter) == std::string::npos)
+				{
+					continue;
+				}
+				std::streambuf* console = std::cout.rdbuf();
+				if (bench.first == "Bond::get_ytm")
+				{
+					std::cout.rdbuf(&null_buffer); // get_ytm prints every iteration
+				}
+				const std::function<void(std::size_t, std::size_t)>& body = bench.second;
+				results.push_back(measure(bench.first, n, t, options.min_time, [&]() { pool.parallel_for(n, body, 64); }));
+				std::cout.rdbuf(console);
+			}
+
+			// Batch engines that split their own work across the pool
+			if (std::string("Bond_Book::price").find(options.filter) != std::string::npos)
+			{
+				results.push_back(measure("Bond_Book::price", n, t, options.min_time, [&]() { b.bond_book.price(b.curve, output, pool); }));
+			}
+			if (std::string("Yield_Solver::solve_batch").find(options.filter) != std::string::npos)
+			{
+				results.push_back(measure("Yield_Solver::solve_batch", n, t, options.min_time, [&]() { b.bond_book.solve_yields(b.bond_prices, yield_results, pool); }));
+			}
+			if (std::string("Libor_Market_Model paths").find(options.filter) != std::string::npos)
+			{
+				// N paths of a 20 period quarterly cap, ns/op is per path
+				std::vector<double> lmm_rates, lmm_vols, lmm_strikes;
+				std::vector<unsigned int> lmm_times;
+				for (unsigned int j = 0; j <= 20; j++)
+				{
+					lmm_rates.push_back(0.03 + 0.001 * j);
+					lmm_times.push_back(91 * (j + 1));
+				}
+				for (unsigned int j = 0; j < 20; j++)
+				{
+					lmm_vols.push_back(0.2);
+					lmm_strikes.push_back(0.035);
+				}
+				Libor_Market_Model lmm(lmm_vols, lmm_rates, lmm_times);
+				results.push_back(measure("Libor_Market_Model paths", n, t, options.min_time, [&]() { lmm.price_optionlets(lmm_strikes, n, 42, pool); }));
+			}
+			if (t == options.threads.front() && std::string("Swaption_Grid curve tick").find(options.filter) != std::string::npos)
+			{
+				// N grid points as expiries at every quarterly pillar times tenors of 1 to 40 periods, the curve moving each run (single threaded)
+				const std::size_t n_tenors = 40;
+				std::size_t n_expiries = n / n_tenors > 0 ? n / n_tenors : 1;
+				std::vector<double> swaption_rates(n_expiries + n_tenors + 1);
+				std::vector<unsigned int> swaption_times(n_expiries + n_tenors + 1);
+				for (std::size_t i = 0; i < swaption_rates.size(); i++)
+				{
+					swaption_rates[i] = 0.03 + 0.00001 * double(i % 100);
+					swaption_times[i] = unsigned(91 * (i + 1));
+				}
+				std::vector<std::size_t> expiry_pillars(n_expiries), tenors(n_tenors);
+				for (std::size_t j = 0; j < n_expiries; j++)
+				{
+					expiry_pillars[j] = j;
+				}
+				for (std::size_t k = 0; k < n_tenors; k++)
+				{
+					tenors[k] = k + 1;
+				}
+				Discount_Curve swaption_curve(swaption_rates, swaption_times);
+				Swaption_Grid grid(swaption_curve, expiry_pillars, tenors);
+				std::vector<double> swaption_strikes(grid.get_swap_rates()), swaption_vols(grid.size(), 0.2), swaption_prices(grid.size());
+				std::size_t run = 0;
+				results.push_back(measure("Swaption_Grid curve tick", grid.size(), 1, options.min_time, [&]()
+				{
+					swaption_rates[run++ % swaption_rates.size()] += 1e-6;
+					swaption_curve = Discount_Curve(swaption_rates, swaption_times);
+					grid.set_curve(swaption_curve);
+					grid.price(swaption_strikes.data(), swaption_vols.data(), true, swaption_prices.data());
+					benchmark_sink.store(swaption_prices[grid.size() - 1], std::memory_order_relaxed);
+				}));
+			}
+			if (std::string("Sabr_Calibration recalibration").find(options.filter) != std::string::npos)
+			{
+				// N quotes as quarterly expiries of 20 strikes, the smiles moving each run, ns/op is per quote
+				const std::size_t n_strikes = 20;
+				std::size_t n_expiries = n / n_strikes > 0 ? n / n_strikes : 1;
+				std::vector<double> sabr_strikes(n_expiries * n_strikes), sabr_vols(n_expiries * n_strikes), sabr_forwards(n_expiries), sabr_expiries(n_expiries);
+				std::vector<Sabr_Parameters> smiles(n_expiries);
+				for (std::size_t j = 0; j < n_expiries; j++)
+				{
+					sabr_forwards[j] = 0.02 + 0.0005 * double(j % 40);
+					sabr_expiries[j] = 91. * double(j % 40 + 1);
+					smiles[j] = Sabr_Parameters{ 0.05, 0.5, -0.3 + 0.01 * double(j % 40), 0.3 + 0.01 * double(j % 40) };
+					for (std::size_t k = 0; k < n_strikes; k++)
+					{
+						sabr_strikes[j * n_strikes + k] = sabr_forwards[j] * exp(-1. + 2. * double(k) / double(n_strikes - 1));
+					}
+				}
+				Sabr_Calibration sabr;
+				std::size_t run = 0;
+				results.push_back(measure("Sabr_Calibration recalibration", n_expiries * n_strikes, t, options.min_time, [&]()
+				{
+					run++;
+					for (std::size_t j = 0; j < n_expiries; j++)
+					{
+						Sabr_Parameters smile = smiles[j];
+						smile.rho += run % 2 ? 0.01 : 0.;
+						for (std::size_t k = 0; k < n_strikes; k++)
+						{
+							sabr_vols[j * n_strikes + k] = Sabr_Calibration::volatility(smile, sabr_forwards[j], sabr_strikes[j * n_strikes + k], sabr_expiries[j]);
+						}
+					}
+					sabr.calibrate(sabr_strikes.data(), sabr_vols.data(), sabr_forwards.data(), sabr_expiries.data(), n_expiries, n_strikes, pool);
+				}));
+			}
+
+			// Intraday ticks on a cap of N optionlets: one pillar moves, only its two optionlets are repriced (single threaded)
+			if (t == options.threads.front() && std::string("Cap_Floor_Book pillar tick").find(options.filter) != std::string::npos)
+			{
+				std::vector<double> tick_rates(n + 1);
+				std::vector<unsigned int> tick_times(n + 1);
+				for (std::size_t i = 0; i <= n; i++)
+				{
+					tick_rates[i] = 0.03 + 0.00001 * double(i);
+					tick_times[i] = unsigned(91 * (i + 1));
+				}
+				Cap_Floor_Book cap_floor_book(b.strikes, b.vols, tick_rates, tick_times, true);
+				std::size_t tick = 0;
+				results.push_back(measure("Cap_Floor_Book pillar tick", n, 1, options.min_time, [&]()
+				{
+					for (std::size_t i = 0; i < n; i++, tick++)
+					{
+						std::size_t pillar = (tick * 7919) % (n + 1);
+						cap_floor_book.set_rate(pillar, tick_rates[pillar] + (tick % 2 ? 0.0001 : 0.));
+						cap_floor_book.reprice();
+					}
+					benchmark_sink.store(cap_floor_book.get_cap_price(), std::memory_order_relaxed);
+				}));
+			}
+
+			// Scenario runs: a cap, a floor and the forward curve of N periods priced into a workspace reset per scenario (single threaded)
+			if (t == options.threads.front() && std::string("Pricing_Workspace scenario").find(options.filter) != std::string::npos)
+			{
+				std::vector<double> scenario_rates(n + 1);
+				std::vector<unsigned int> scenario_times(n + 1);
+				for (std::size_t i = 0; i <= n; i++)
+				{
+					scenario_rates[i] = 0.03 + 0.00001 * double(i);
+					scenario_times[i] = unsigned(91 * (i + 1));
+				}
+				Pricing_Workspace workspace;
+				std::size_t scenario = 0;
+				results.push_back(measure("Pricing_Workspace scenario", n, 1, options.min_time, [&]()
+				{
+					workspace.reset();
+					scenario_rates[scenario++ % (n + 1)] += 1e-6;
+					double* caps = workspace.price_cap(b.strikes.data(), b.vols.data(), scenario_rates.data(), scenario_times.data(), n, true);
+					double* floors = workspace.price_floor(b.strikes.data(), b.vols.data(), scenario_rates.data(), scenario_times.data(), n, true);
+					double* forwards = workspace.forward_rates(scenario_rates.data(), scenario_times.data(), n + 1, true);
+					benchmark_sink.store(caps[n - 1] + floors[n - 1] + forwards[n - 1], std::memory_order_relaxed);
+				}));
+			}
+
+			// Scenario runs building the curve and a cap object of N periods on the workspace (single threaded)
+			if (t == options.threads.front() && std::string("Pricing_Workspace objects").find(options.filter) != std::string::npos)
+			{
+				std::vector<double> scenario_rates(n + 1);
+				std::vector<unsigned int> scenario_times(n + 1);
+				for (std::size_t i = 0; i <= n; i++)
+				{
+					scenario_rates[i] = 0.03 + 0.00001 * double(i);
+					scenario_times[i] = unsigned(91 * (i + 1));
+				}
+				Pricing_Workspace workspace;
+				std::size_t scenario = 0;
+				results.push_back(measure("Pricing_Workspace objects", n, 1, options.min_time, [&]()
+				{
+					workspace.reset();
+					scenario_rates[scenario++ % (n + 1)] += 1e-6;
+					Discount_Curve curve(scenario_rates, scenario_times, 4, &workspace);
+					Rate_Cap cap(b.strikes, b.vols, curve, true, &workspace);
+					benchmark_sink.store(cap.get_prices()[n - 1], std::memory_order_relaxed);
+				}));
+			}
+
+			// Recalibration ticks where one quote in ten moves, through a calibration context (single threaded)
+			if (t == options.threads.front() && std::string("Vol_Calibration tick").find(options.filter) != std::string::npos)
+			{
+				Vol_Calibration calibration;
+				std::vector<double> tick_prices(b.caplet_prices);
+				std::size_t tick = 0;
+				results.push_back(measure("Vol_Calibration tick", n, 1, options.min_time, [&]()
+				{
+					tick++;
+					for (std::size_t i = tick % 10; i < n; i += 10)
+					{
+						tick_prices[i] = b.caplet_prices[i] * (tick % 2 ? 1.0001 : 1.);
+					}
+					calibration.solve_batch(tick_prices.data(), b.forwards.data(), b.strikes.data(), b.t_1_days.data(), b.discounts.data(), n, true, vol_results.data());
+				}));
+			}
+
+			for (std::size_t j = first_result; j < results.size(); j++)
+			{
+				const Bench_Result& r = results[j];
+				std::cout << std::left << std::setw(36) << r.name << std::right << std::setw(9) << r.book_size << std::setw(4) << r.threads
+					<< std::setw(12) << std::fixed << std::setprecision(1) << r.ns_per_op
+					<< std::setw(14) << std::scientific << std::setprecision(3) << r.ops_per_s
+					<< std::setw(12) << std::fixed << std::setprecision(2) << r.allocs_per_op << std::endl;
+			}
+		}
+	}
+
+	std::ofstream out(options.output);
+	out << "benchmark,book_size,threads,ns_per_op,ops_per_s,allocs_per_op,instruction_set\n";
+	for (auto &r : results)
+	{
+		out << r.name << "," << r.book_size << "," << r.threads << "," << r.ns_per_op << "," << r.ops_per_s << "," << r.allocs_per_op
+			<< "," << Black_Simd::get_instruction_set_name(Black_Simd::get_instruction_set()) << "\n";
+	}
+	std::cout << "\nResults written to " << options.output << std::endl;
+
+	if (!options.baseline.empty())
+	{
+		return compare_with_baseline(results, options.baseline, options.tolerance) > 0 ? 1 : 0;
+	}
+	return 0;
+}
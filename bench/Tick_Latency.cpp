@@ -0,0 +1,117 @@
+#include "Tick_Pricer.h"
+#include "Tick_Replay.h"
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+* Project:    Project 1
+* Filename:   Tick_Latency.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Offline tick-to-price latency test: replays generated ticks into a Tick_Pricer and reports the latency percentiles.
+*
+* Usage: tick_latency [--ticks 200000] [--rate ticks_per_second] [--books 4] [--pillars 41] [--cpu n] [--warmup 10000]
+* --rate 0 submits as fast as possible (measures throughput and queueing); a finite rate measures the latency of
+* a tick arriving at an idle loop. The exit code is 1 if any tick was rejected.
+*/
+
+
+namespace
+{
+	struct Options
+	{
+		std::size_t ticks{ 200000 };
+		double rate{ 100000 };
+		std::size_t books{ 4 };
+		std::size_t pillars{ 41 };
+		int cpu{ -1 };
+		std::size_t warmup{ 10000 };
+	};
+
+	Options parse_options(int argc, char** argv)
+	{
+		Options options;
+		for (int i = 1; i < argc; i++)
+		{
+			std::string arg = argv[i];
+			std::string value = i + 1 < argc ? argv[i + 1] : "0";
+			if (arg == "--ticks") options.ticks = std::stoul(value);
+			else if (arg == "--rate") options.rate = std::stod(value);
+			else if (arg == "--books") options.books = std::stoul(value);
+			else if (arg == "--pillars") options.pillars = std::stoul(value);
+			else if (arg == "--cpu") options.cpu = std::stoi(value);
+			else if (arg == "--warmup") options.warmup = std::stoul(value);
+			else {
+				std::cerr << "Unknown option " << arg << std::endl;
+				std::exit(2);
+			}
+			i++;
+		}
+		if (options.pillars < 2 || options.books == 0)
+		{
+			std::cerr << "Need at least 2 pillars and 1 book." << std::endl;
+			std::exit(2);
+		}
+		return options;
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	Options options = parse_options(argc, argv);
+
+	// Quarterly pillars of an upward sloping curve, books of caps/floors at different strikes
+	std::vector<double> rates;
+	std::vector<unsigned int> times;
+	for (std::size_t i = 0; i < options.pillars; i++)
+	{
+		rates.push_back(0.03 + 0.0004 * i);
+		times.push_back(unsigned(91 * (i + 1)));
+	}
+	std::vector<double> vols(options.pillars - 1);
+	for (std::size_t i = 0; i < vols.size(); i++)
+	{
+		vols[i] = 0.25 - 0.002 * i;
+	}
+
+	Tick_Pricer pricer(rates, times, true, 4, 65536, options.ticks);
+	for (std::size_t b = 0; b < options.books; b++)
+	{
+		pricer.add_book(std::vector<double>(vols.size(), 0.02 + 0.01 * b), vols);
+	}
+	Tick_Replay replay(rates, vols, options.books);
+	pricer.start(options.cpu);
+
+	// Warm up caches and branch predictors, then measure
+	replay.generate(options.warmup);
+	replay.replay(pricer, 0);
+	replay.generate(options.ticks);
+	pricer.stop();
+	pricer.reset_latencies();
+	pricer.start(options.cpu);
+	Replay_Report report = replay.replay(pricer, options.rate);
+	pricer.stop();
+	Latency_Summary summary = pricer.get_latency_summary();
+
+	std::cout << std::fixed << std::setprecision(0);
+	std::cout << "Books " << options.books << " x " << vols.size() << " optionlets, pricing thread "
+		<< (pricer.is_pinned() ? "pinned to CPU " + std::to_string(options.cpu) : std::string("not pinned")) << std::endl;
+	std::cout << "Ticks " << report.ticks_sent << " at " << report.ticks_per_second << " ticks/s (requested "
+		<< (options.rate > 0 ? std::to_string(long(options.rate)) : std::string("max")) << "), " << pricer.get_batches()
+		<< " batches, " << report.ring_full_retries << " ring full retries, " << pricer.get_ticks_rejected() << " rejected" << std::endl;
+	std::cout << "Tick-to-price latency (ns): mean " << summary.mean << "  p50 " << summary.p50 << "  p90 " << summary.p90
+		<< "  p99 " << summary.p99 << "  p99.9 " << summary.p999 << "  max " << summary.max << std::endl;
+
+	Book_Quote quote;
+	for (std::size_t b = 0; b < options.books; b++)
+	{
+		pricer.get_quote(b, quote);
+		std::cout << std::setprecision(6) << "Book " << b << ": cap " << quote.cap_price << "  floor " << quote.floor_price
+			<< "  ticks " << quote.ticks_applied << std::endl;
+	}
+	return pricer.get_ticks_rejected() > 0;
+}
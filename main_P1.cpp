@@ -4,6 +4,8 @@
 #include "Term_Structure.h"
 #include "Rate_Cap.h"
 #include "Rate_Floor.h"
+#include "Rate_Cap_Floor.h"
+#include "Strike_Sweep.h"
 #include <iostream>
 
 /**
@@ -33,6 +35,10 @@ void print_error_messages(int error_code) //Function to print error messages to
 	{
 		std::cout << "ERROR: Principal of a bond msut be a positive number.";
 	}
+	if (error_code == 5)
+	{
+		std::cout << "ERROR: Market data file could not be opened or written.";
+	}
 	return;
 }
 
@@ -47,14 +53,17 @@ int main()
 		std::vector<double> scenario_1_volatilities(7, 0.2);
 		std::vector<unsigned int> scenario_1_times_of_rates{ 91,182,273,365,456,547,638,730 };
 
+		std::vector<double> scenario_1_strikes;
 		for (double i = 0.07; i <= 0.09; i += 0.01)
 		{
-			std::cout << "\n Strike " << i << std::endl;
-			std::vector<double> scenario_1_my_strikes(7, i);
-			Rate_Cap scenario_1_caps = Rate_Cap(scenario_1_my_strikes, scenario_1_volatilities, scenario_1_interest_rates, scenario_1_times_of_rates, true);
-			Rate_Floor scenario_1_floors = Rate_Floor(scenario_1_my_strikes, scenario_1_volatilities, scenario_1_interest_rates, scenario_1_times_of_rates, true);
-			scenario_1_caps.print_prices();
-			scenario_1_floors.print_prices();
+			scenario_1_strikes.push_back(i);
+		}
+		std::vector<double> scenario_1_vol_shifts{ 0. };
+		Strike_Sweep scenario_1_sweep = Strike_Sweep(scenario_1_strikes, scenario_1_vol_shifts, scenario_1_volatilities, scenario_1_interest_rates, scenario_1_times_of_rates, true); // curve computed once for every strike
+		for (std::size_t i = 0; i < scenario_1_strikes.size(); i++)
+		{
+			std::cout << "\n Strike " << scenario_1_strikes[i] << std::endl;
+			scenario_1_sweep.print_prices(i, 0);
 		}
 
 
@@ -66,11 +75,10 @@ int main()
 		std::vector<double> scenario_2_volatilities{ 0.1533, 0.1731, 0.1727, 0.1752, 0.1809, 0.1800, 0.1805 };
 		std::vector<double> scenario_2_strikes(7, 0.059);
 
-		Rate_Cap scenario_2_caps = Rate_Cap(scenario_2_strikes, scenario_2_volatilities, scenario_2_interest_rates, scenario_2_times_of_rates, true);
-		Rate_Floor scenario_2_floors = Rate_Floor(scenario_2_strikes, scenario_2_volatilities, scenario_2_interest_rates, scenario_2_times_of_rates, true);
+		Discount_Curve scenario_2_curve = Discount_Curve(scenario_2_interest_rates, scenario_2_times_of_rates); // shared by the cap and the floor
+		Rate_Cap_Floor scenario_2_caps_floors = Rate_Cap_Floor(scenario_2_strikes, scenario_2_volatilities, scenario_2_curve, true); // cap and floor priced in one pass
 
-		scenario_2_caps.print_prices();
-		scenario_2_floors.print_prices();
+		scenario_2_caps_floors.print_prices();
 
 
 
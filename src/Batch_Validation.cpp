@@ -0,0 +1,257 @@
+#include "Batch_Validation.h"
+#include "Optionlet_Batch.h"
+#include <cmath>
+#include <limits>
+
+
+/**
+* Project:    Project 1
+* Filename:   Batch_Validation.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Validate-once checks of whole input arrays, reporting a status per record instead of throwing.
+*/
+
+
+namespace
+{
+	inline bool positive(const double& x)
+	{
+		return x > 0 && std::isfinite(x); // false for NaN
+	}
+
+	inline bool non_negative(const double& x)
+	{
+		return x >= 0 && std::isfinite(x);
+	}
+
+	/**
+	* Function to check that a discretely compounded period holds at least one whole compounding period,
+	* as Discrete_Compounding divides by their number (see Compounding.h). Always true when continuous.
+	*/
+	inline bool compoundable(const unsigned int& t_1, const unsigned int& t_2, const int& freq, const bool& continuous)
+	{
+		return continuous || int(((t_2 - t_1) * double(freq)) / 365.) > 0;
+	}
+}
+
+
+/**
+* Function to check the inputs of one caplet or floorlet given by a pair of zero rates, with the
+* same rules (and codes) as the Rate_Derivative and Term_Structure constructors, applied once.
+* @param strike const double reference, denotes the strike of the option.
+* @param vol const double reference, denotes the interest rate volatility.
+* @param rate_1 const double reference, denotes the interest rate at time t_1.
+* @param t_1 const usigned int reference, denotes the time at which the first interest rate occurs.
+* @param rate_2 const double reference, denotes the interest rate at time t_2.
+* @param t_2 const usigned int reference, denotes the time at which the second interest rate occurs.
+* @param freq const int reference, denotes the compounding frequency.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* A discrete period shorter than one compounding period (t_2 - t_1 < 365/freq days) has no forward rate and is
+* reported as Input_Time_Order.
+*/
+Input_Status Batch_Validation::validate_optionlet(const double& strike, const double& vol, const double& rate_1, const unsigned int& t_1, const double& rate_2, const unsigned int& t_2, const int& freq, const bool& continuous)
+{
+	if (t_2 <= t_1)
+	{
+		return Input_Time_Order;
+	}
+	else if (!positive(rate_1) || !positive(rate_2) || t_1 == 0 || freq <= 0 || !non_negative(strike) || !non_negative(vol))
+	{
+		return Input_Not_Positive;
+	}
+	else if (!compoundable(t_1, t_2, freq, continuous))
+	{
+		return Input_Time_Order;
+	}
+	return Input_Valid;
+}
+
+
+/**
+* Function to check a whole set of zero rates, with the same rules (and codes) as Optionlet_Batch::forward_curve.
+* @param rates const double pointer, denotes the zero rates at each pillar.
+* @param time_of_rates const unsigned int pointer, denotes the time (days) of each pillar.
+* @param n_rates const size_t reference, denotes the number of pillars.
+* @param freq const int reference, denotes the compounding frequency.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+*/
+Input_Status Batch_Validation::validate_curve(const double* rates, const unsigned int* time_of_rates, const std::size_t& n_rates, const int& freq, const bool& continuous)
+{
+	if (n_rates == 0)
+	{
+		return Input_Valid;
+	}
+	if (!positive(rates[0]) || time_of_rates[0] == 0 || freq <= 0)
+	{
+		return Input_Not_Positive;
+	}
+	for (std::size_t i = 0; i + 1 < n_rates; i++)
+	{
+		if (time_of_rates[i + 1] <= time_of_rates[i])
+		{
+			return Input_Time_Order;
+		}
+		else if (!positive(rates[i + 1]))
+		{
+			return Input_Not_Positive;
+		}
+		else if (!compoundable(time_of_rates[i], time_of_rates[i + 1], freq, continuous))
+		{
+			return Input_Time_Order;
+		}
+	}
+	return Input_Valid;
+}
+
+
+/**
+* Function to check n optionlets, each given by its own pair of zero rates, in a single pass.
+* Parameters as for validate_optionlet, one entry per optionlet.
+* @param status Input_Status pointer, denotes the output array of statuses (one per optionlet).
+* Returns the number of valid optionlets.
+*/
+std::size_t Batch_Validation::validate_optionlets(const double* strike, const double* vol, const double* rate_1, const unsigned int* t_1, const double* rate_2, const unsigned int* t_2, const std::size_t& n, Input_Status* status, const int& freq, const bool& continuous)
+{
+	std::size_t n_valid = 0;
+	for (std::size_t i = 0; i < n; i++)
+	{
+		status[i] = validate_optionlet(strike[i], vol[i], rate_1[i], t_1[i], rate_2[i], t_2[i], freq, continuous);
+		n_valid += status[i] == Input_Valid;
+	}
+	return n_valid;
+}
+
+
+/**
+* Function to check the optionlets written on consecutive periods of a set of zero rates, in a single pass.
+* Optionlet i only depends on pillars i and i+1, so a bad pillar invalidates the two optionlets it bounds
+* rather than the whole curve, and the others can still be priced with Optionlet_Batch::forward_periods.
+* @param strike const double pointer, denotes the strike of each optionlet (n_rates-1 entries).
+* @param vol const double pointer, denotes the volatility of each optionlet (n_rates-1 entries).
+* @param rates const double pointer, denotes the zero rates at each pillar.
+* @param time_of_rates const unsigned int pointer, denotes the time (days) of each pillar.
+* @param n_rates const size_t reference, denotes the number of pillars.
+* @param status Input_Status pointer, denotes the output array of statuses (n_rates-1 entries).
+* @param freq const int reference, denotes the compounding frequency.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* Returns the number of valid optionlets.
+*/
+std::size_t Batch_Validation::validate_curve_optionlets(const double* strike, const double* vol, const double* rates, const unsigned int* time_of_rates, const std::size_t& n_rates, Input_Status* status, const int& freq, const bool& continuous)
+{
+	std::size_t n_valid = 0;
+	for (std::size_t i = 0; i + 1 < n_rates; i++)
+	{
+		status[i] = validate_optionlet(strike[i], vol[i], rates[i], time_of_rates[i], rates[i + 1], time_of_rates[i + 1], freq, continuous);
+		n_valid += status[i] == Input_Valid;
+	}
+	return n_valid;
+}
+
+
+/**
+* Function to check the bonds of a flat cashflow table (see Bond_Book.h) in a single pass.
+* @param amounts const double pointer, denotes the cashflows of every bond (principal included).
+* @param times const double pointer, denotes the time (days) of every cashflow.
+* @param offsets const size_t pointer, denotes where the cashflows of each bond start (n_bonds + 1 entries).
+* @param n_bonds const size_t reference, denotes the number of bonds.
+* @param status Input_Status pointer, denotes the output array of statuses (one per bond).
+* Returns the number of valid bonds.
+*/
+std::size_t Batch_Validation::validate_cashflows(const double* amounts, const double* times, const std::size_t* offsets, const std::size_t& n_bonds, Input_Status* status)
+{
+	std::size_t n_valid = 0;
+	for (std::size_t b = 0; b < n_bonds; b++)
+	{
+		std::size_t begin = offsets[b];
+		std::size_t end = offsets[b + 1];
+		if (end <= begin)
+		{
+			status[b] = Input_Size_Mismatch; // no cashflows
+			continue;
+		}
+
+		status[b] = Input_Valid;
+		for (std::size_t c = begin; c < end; c++)
+		{
+			if (!non_negative(amounts[c]) || !non_negative(times[c]))
+			{
+				status[b] = Input_Not_Positive;
+				break;
+			}
+		}
+		if (status[b] == Input_Valid && !(amounts[end - 1] > 0))
+		{
+			status[b] = Input_Principal; // the last cashflow repays the principal
+		}
+		n_valid += status[b] == Input_Valid;
+	}
+	return n_valid;
+}
+
+
+/**
+* Function to price n optionlets, each given by its own pair of zero rates, as caplets, floorlets and digitals
+* with no exceptions: the inputs are validated once in a single pass, the forwards and the fused pricing kernel
+* then run unchecked over the whole array (see Optionlet_Batch::pair_forwards), and the outputs of the invalid
+* records are set to NaN. A bad quote therefore costs its own record only, never the batch.
+* @param strike const double pointer, denotes the strike of each optionlet.
+* @param vol const double pointer, denotes the volatility of each optionlet.
+* @param rate_1 const double pointer, denotes the zero rate at the start of each period.
+* @param t_1 const unsigned int pointer, denotes the start (days) of each period.
+* @param rate_2 const double pointer, denotes the zero rate at the end of each period.
+* @param t_2 const unsigned int pointer, denotes the end (days) of each period.
+* @param n const size_t reference, denotes the number of optionlets.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param status Input_Status pointer, denotes the output array of statuses.
+* @param forward double pointer, denotes the output array of forward rates.
+* @param expiry double pointer, denotes the output array of period start times.
+* @param discount double pointer, denotes the output array of ZCB prices at period ends.
+* @param cap double pointer, denotes the output array of caplet prices.
+* @param floor double pointer, denotes the output array of floorlet prices.
+* @param digital_cap double pointer, denotes the output array of digital caplet prices.
+* @param digital_floor double pointer, denotes the output array of digital floorlet prices.
+* @param freq const int reference, denotes the compounding frequency.
+* Returns the number of optionlets priced.
+*/
+std::size_t Batch_Validation::price_optionlets(const double* strike, const double* vol, const double* rate_1, const unsigned int* t_1, const double* rate_2, const unsigned int* t_2, const std::size_t& n, const bool& continuous,
+	Input_Status* status, double* forward, double* expiry, double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const int& freq)
+{
+	std::size_t n_valid = validate_optionlets(strike, vol, rate_1, t_1, rate_2, t_2, n, status, freq, continuous);
+	Optionlet_Batch::pair_forwards(rate_1, t_1, rate_2, t_2, n, continuous, freq, status, forward, expiry, discount);
+	Optionlet_Batch::optionlet_values(strike, vol, forward, expiry, discount, cap, floor, digital_cap, digital_floor, n);
+
+	if (n_valid < n)
+	{
+		const double nan = std::numeric_limits<double>::quiet_NaN();
+		for (std::size_t i = 0; i < n; i++)
+		{
+			if (status[i] != Input_Valid)
+			{
+				forward[i] = nan;
+				cap[i] = nan;
+				floor[i] = nan;
+				digital_cap[i] = nan;
+				digital_floor[i] = nan;
+			}
+		}
+	}
+	return n_valid;
+}
+
+
+/**
+* Function to return a printable description of a validation status.
+* @param status const Input_Status reference, denotes the outcome of a check.
+*/
+const char* Batch_Validation::get_status_name(const Input_Status& status)
+{
+	switch (status)
+	{
+	case Input_Valid: return "valid";
+	case Input_Time_Order: return "second rate does not occur after the first (by one compounding period if discrete)";
+	case Input_Not_Positive: return "rate, time, strike, volatility or frequency out of range";
+	case Input_Size_Mismatch: return "inconsistent number of inputs";
+	default: return "principal must be positive";
+	}
+}
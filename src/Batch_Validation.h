@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+
+
+/**
+* Project:    Project 1
+* Filename:   Batch_Validation.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Validate-once checks of whole input arrays, reporting a status per record instead of throwing.
+*/
+
+// The codes match the integers thrown by the constructors (see print_error_messages in main_P1.cpp)
+enum Input_Status : unsigned char
+{
+	Input_Valid = 0,
+	Input_Time_Order = 1, // t_1 < t_2 violated, or a discrete period shorter than one compounding period
+	Input_Not_Positive = 2, // rate, time, strike, volatility or frequency out of range (or not finite)
+	Input_Size_Mismatch = 3,
+	Input_Principal = 4 // bond without a positive final cashflow
+};
+
+
+class Batch_Validation
+{
+public:
+	// Single record checks
+	static Input_Status validate_optionlet(const double& strike, const double& vol, const double& rate_1, const unsigned int& t_1, const double& rate_2, const unsigned int& t_2, const int& freq = 4, const bool& continuous = true);
+	static Input_Status validate_curve(const double* rates, const unsigned int* time_of_rates, const std::size_t& n_rates, const int& freq = 4, const bool& continuous = true);
+
+	// Whole array checks, one status per record, returning the number of valid records
+	static std::size_t validate_optionlets(const double* strike, const double* vol, const double* rate_1, const unsigned int* t_1, const double* rate_2, const unsigned int* t_2, const std::size_t& n, Input_Status* status, const int& freq = 4, const bool& continuous = true);
+	static std::size_t validate_curve_optionlets(const double* strike, const double* vol, const double* rates, const unsigned int* time_of_rates, const std::size_t& n_rates, Input_Status* status, const int& freq = 4, const bool& continuous = true);
+	static std::size_t validate_cashflows(const double* amounts, const double* times, const std::size_t* offsets, const std::size_t& n_bonds, Input_Status* status);
+
+	// Validate then price, invalid records are skipped and their outputs set to NaN
+	static std::size_t price_optionlets(const double* strike, const double* vol, const double* rate_1, const unsigned int* t_1, const double* rate_2, const unsigned int* t_2, const std::size_t& n, const bool& continuous,
+		Input_Status* status, double* forward, double* expiry, double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const int& freq = 4);
+
+	static const char* get_status_name(const Input_Status& status);
+};
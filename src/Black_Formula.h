@@ -0,0 +1,106 @@
+#pragma once
+#include <cmath>
+
+
+/**
+* Project:    Project 1
+* Filename:   Black_Formula.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Black's formula for caplets and floorlets as one template over the numeric type.
+*
+* Like the compounding policies of Compounding.h, black_value is written once over the numeric type T and serves
+* double, float, the forward mode Dual of Dual_Number.h and the SIMD lane types of Simd_Math.h. The logarithm and
+* normal CDF come from a Normal policy: Libm_Normal calls log and erfc unqualified (so Dual finds its own through
+* argument dependent lookup), Simd_Normal in Simd_Math.h supplies the lane-generic approximations.
+*/
+struct Libm_Normal
+{
+	template<class T> static T log(const T& x)
+	{
+		using std::log;
+		return log(x);
+	}
+
+	/**
+	* Function to compute the CDF of the standard normal distribution.
+	*/
+	template<class T> static T cdf(const T& x)
+	{
+		using std::erfc;
+		return T(0.5) * erfc(-x / T(1.4142135623730950488));
+	}
+
+	/**
+	* Function to compute N(x) and N(-x) from one erfc evaluation of the tail N(-|x|).
+	*/
+	template<class T> static void cdf_pair(const T& x, T& lower, T& upper)
+	{
+		using std::erfc;
+		using std::fabs;
+		T tail = T(0.5) * erfc(fabs(x) / T(1.4142135623730950488));
+		lower = x > T(0.0) ? T(1.0) - tail : tail;
+		upper = x > T(0.0) ? tail : T(1.0) - tail;
+	}
+};
+
+
+/**
+* Function to compute d1 = (log(F/K) + std_dev^2/2) / std_dev and d2 = d1 - std_dev.
+* @param forward const T reference, denotes the forward rate.
+* @param strike const T reference, denotes the strike of the option.
+* @param std_dev const T reference, denotes the volatility multiplied by sqrt(t_1/365).
+* @param d1 T reference, set to d1.
+* @param d2 T reference, set to d2.
+*/
+template<class T, class Normal = Libm_Normal> inline void black_d(const T& forward, const T& strike, const T& std_dev, T& d1, T& d2)
+{
+	d1 = (Normal::log(forward / strike) + T(0.5) * std_dev * std_dev) / std_dev;
+	d2 = d1 - std_dev;
+}
+
+
+/**
+* Function to combine the normal CDFs into the undiscounted price, F N(d1) - K N(d2) for a caplet and
+* K N(-d2) - F N(-d1) for a floorlet, so kernels evaluating the CDFs of many optionlets at once share the formula.
+* @param forward const T reference, denotes the forward rate.
+* @param strike const T reference, denotes the strike of the option.
+* @param n_1 const T reference, denotes N(d1) for a caplet, N(-d1) for a floorlet.
+* @param n_2 const T reference, denotes N(d2) for a caplet, N(-d2) for a floorlet.
+* @param call const boolean reference, denotes whether the option is a caplet(true) or floorlet(false).
+*/
+template<class T> inline T black_combine(const T& forward, const T& strike, const T& n_1, const T& n_2, const bool& call)
+{
+	return call ? forward * n_1 - strike * n_2 : strike * n_2 - forward * n_1;
+}
+
+
+/**
+* Function to compute the undiscounted Black price of a caplet or floorlet. The floorlet is priced from N(-d1)
+* and N(-d2) directly, not by put-call parity, which cancels out of the money.
+* @param forward const T reference, denotes the forward rate.
+* @param strike const T reference, denotes the strike of the option.
+* @param std_dev const T reference, denotes the volatility multiplied by sqrt(t_1/365).
+* @param call const boolean reference, denotes whether the option is a caplet(true) or floorlet(false).
+* @param d1 T reference, set to d1.
+* @param d2 T reference, set to d2.
+*/
+template<class T, class Normal = Libm_Normal> inline T black_value(const T& forward, const T& strike, const T& std_dev, const bool& call, T& d1, T& d2)
+{
+	black_d<T, Normal>(forward, strike, std_dev, d1, d2);
+	if (call)
+	{
+		return black_combine(forward, strike, Normal::cdf(d1), Normal::cdf(d2), true);
+	}
+	return black_combine(forward, strike, Normal::cdf(T(0.0) - d1), Normal::cdf(T(0.0) - d2), false);
+}
+
+
+/**
+* Function to compute the undiscounted Black price of a caplet or floorlet. Parameters as above.
+*/
+template<class T, class Normal = Libm_Normal> inline T black_value(const T& forward, const T& strike, const T& std_dev, const bool& call)
+{
+	T d1, d2;
+	return black_value<T, Normal>(forward, strike, std_dev, call, d1, d2);
+}
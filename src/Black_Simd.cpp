@@ -0,0 +1,357 @@
+#include "Black_Simd.h"
+#include "Black_Formula.h"
+#include "Hot_Path_Counters.h"
+#include <atomic>
+#include <cmath>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+/**
+* Project:    Project 1
+* Filename:   Black_Simd.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Runtime instruction set selection and scalar reference kernel for the Black pricers.
+*/
+
+
+namespace
+{
+	/**
+	* Function to detect the widest instruction set supported by both the CPU and the OS.
+	*/
+	Black_Simd::Instruction_Set detect_instruction_set()
+	{
+#if defined(__x86_64__) || defined(__i386__)
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f"))
+		{
+			return Black_Simd::AVX512;
+		}
+		if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+		{
+			return Black_Simd::AVX2;
+		}
+		if (__builtin_cpu_supports("sse2"))
+		{
+			return Black_Simd::SSE2;
+		}
+#elif defined(_M_X64) || defined(_M_IX86)
+		int info[4];
+		__cpuid(info, 1);
+		bool sse2 = (info[3] & (1 << 26)) != 0;
+		bool fma = (info[2] & (1 << 12)) != 0;
+		bool os_saves_registers = (info[2] & (1 << 27)) != 0;
+		unsigned long long xcr0 = os_saves_registers ? _xgetbv(0) : 0;
+
+		__cpuidex(info, 7, 0);
+		bool avx2 = (info[1] & (1 << 5)) != 0;
+		bool avx512f = (info[1] & (1 << 16)) != 0;
+
+		if (avx512f && (xcr0 & 0xE6) == 0xE6) // XMM, YMM and ZMM state enabled by the OS
+		{
+			return Black_Simd::AVX512;
+		}
+		if (avx2 && fma && (xcr0 & 0x6) == 0x6) // XMM and YMM state enabled by the OS
+		{
+			return Black_Simd::AVX2;
+		}
+		if (sse2)
+		{
+			return Black_Simd::SSE2;
+		}
+#endif
+		return Black_Simd::Scalar;
+	}
+
+	// -1 until the first kernel call (or set_instruction_set) selects a set.
+	std::atomic<int> selected_instruction_set{ -1 };
+}
+
+
+/**
+* Function to price n caplets with the widest kernel available (see Optionlet_Batch::caplet_prices).
+*/
+void Black_Simd::caplet_prices(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n)
+{
+	prices(strike, vol, forward, t_1, discount, price, n, true);
+}
+
+
+/**
+* Function to price n floorlets with the widest kernel available (see Optionlet_Batch::floorlet_prices).
+*/
+void Black_Simd::floorlet_prices(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n)
+{
+	prices(strike, vol, forward, t_1, discount, price, n, false);
+}
+
+
+/**
+* Function to value n optionlets as caplets, floorlets, digital caplets and digital floorlets in one
+* pass with the widest kernel available (see simd_black_values_tile in Simd_Math.h). The digitals
+* pay one unit at t_2 if the rate sets above (caplet) or below (floorlet) the strike.
+* @param cap double pointer, denotes the output array of caplet prices.
+* @param floor double pointer, denotes the output array of floorlet prices.
+* @param digital_cap double pointer, denotes the output array of digital caplet prices.
+* @param digital_floor double pointer, denotes the output array of digital floorlet prices.
+* Remaining parameters as for caplet_prices.
+*/
+void Black_Simd::optionlet_values(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n)
+{
+	Hot_Path_Counters::record_pricings(Counter_Black, n);
+	switch (get_instruction_set())
+	{
+	case AVX512:
+		values_avx512(strike, vol, forward, t_1, discount, cap, floor, digital_cap, digital_floor, n);
+		break;
+	case AVX2:
+		values_avx2(strike, vol, forward, t_1, discount, cap, floor, digital_cap, digital_floor, n);
+		break;
+	case SSE2:
+		values_sse2(strike, vol, forward, t_1, discount, cap, floor, digital_cap, digital_floor, n);
+		break;
+	default:
+		values_scalar(strike, vol, forward, t_1, discount, cap, floor, digital_cap, digital_floor, n);
+	}
+}
+
+
+/**
+* Function to compute exp(x[i]) for n values with the widest kernel available (see simd_exp in Simd_Math.h).
+* @param x const double pointer, denotes the exponents.
+* @param result double pointer, denotes the output array (may alias x).
+* @param n const size_t reference, denotes the number of values.
+*/
+void Black_Simd::exponentials(const double* x, double* result, const std::size_t& n)
+{
+	switch (get_instruction_set())
+	{
+	case AVX512:
+		exponentials_avx512(x, result, n);
+		break;
+	case AVX2:
+		exponentials_avx2(x, result, n);
+		break;
+	case SSE2:
+		exponentials_sse2(x, result, n);
+		break;
+	default:
+		exponentials_scalar(x, result, n);
+	}
+}
+
+
+/**
+* Function to price n caplets in single precision with the widest kernel available.
+* Parameters as for the double overload.
+*/
+void Black_Simd::caplet_prices(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n)
+{
+	prices(strike, vol, forward, t_1, discount, price, n, true);
+}
+
+
+/**
+* Function to price n floorlets in single precision with the widest kernel available.
+* Parameters as for the double overload.
+*/
+void Black_Simd::floorlet_prices(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n)
+{
+	prices(strike, vol, forward, t_1, discount, price, n, false);
+}
+
+
+/**
+* Function to compute exp(x[i]) in single precision for n values with the widest kernel available.
+* Parameters as for the double overload.
+*/
+void Black_Simd::exponentials(const float* x, float* result, const std::size_t& n)
+{
+	switch (get_instruction_set())
+	{
+	case AVX512:
+		exponentials_avx512(x, result, n);
+		break;
+	case AVX2:
+		exponentials_avx2(x, result, n);
+		break;
+	case SSE2:
+		exponentials_sse2(x, result, n);
+		break;
+	default:
+		exponentials_scalar(x, result, n);
+	}
+}
+
+
+/**
+* Function to return the widest instruction set supported by the running machine.
+* The CPU is queried once and the answer is reused.
+*/
+Black_Simd::Instruction_Set Black_Simd::get_supported_instruction_set()
+{
+	static const Instruction_Set supported = detect_instruction_set();
+	return supported;
+}
+
+
+/**
+* Function to return the instruction set currently used by the kernels.
+*/
+Black_Simd::Instruction_Set Black_Simd::get_instruction_set()
+{
+	int set = selected_instruction_set.load(std::memory_order_relaxed);
+	if (set < 0)
+	{
+		set = get_supported_instruction_set();
+		selected_instruction_set.store(set, std::memory_order_relaxed);
+	}
+	return Instruction_Set(set);
+}
+
+
+/**
+* Function to force the kernels onto a given instruction set (e.g. to compare against the scalar path).
+* Requests beyond what the machine supports fall back to the widest supported set.
+* @param requested const Instruction_Set reference, denotes the desired instruction set.
+*/
+void Black_Simd::set_instruction_set(const Instruction_Set& requested)
+{
+	Instruction_Set supported = get_supported_instruction_set();
+	selected_instruction_set.store(requested < supported ? requested : supported, std::memory_order_relaxed);
+}
+
+
+/**
+* Function to return a printable name for an instruction set.
+* @param set const Instruction_Set reference, denotes the instruction set.
+*/
+const char* Black_Simd::get_instruction_set_name(const Instruction_Set& set)
+{
+	switch (set)
+	{
+	case SSE2: return "SSE2";
+	case AVX2: return "AVX2";
+	case AVX512: return "AVX-512";
+	default: return "Scalar";
+	}
+}
+
+
+/**
+* Function to route a batch to the kernel of the selected instruction set, counting the options priced.
+*/
+void Black_Simd::prices(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n, const bool& call)
+{
+	Hot_Path_Counters::record_pricings(Counter_Black, n);
+	switch (get_instruction_set())
+	{
+	case AVX512:
+		prices_avx512(strike, vol, forward, t_1, discount, price, n, call);
+		break;
+	case AVX2:
+		prices_avx2(strike, vol, forward, t_1, discount, price, n, call);
+		break;
+	case SSE2:
+		prices_sse2(strike, vol, forward, t_1, discount, price, n, call);
+		break;
+	default:
+		prices_scalar(strike, vol, forward, t_1, discount, price, n, call);
+	}
+}
+
+
+/**
+* Function to route a single precision batch to the kernel of the selected instruction set, counting the options priced.
+*/
+void Black_Simd::prices(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n, const bool& call)
+{
+	Hot_Path_Counters::record_pricings(Counter_Black, n);
+	switch (get_instruction_set())
+	{
+	case AVX512:
+		prices_avx512(strike, vol, forward, t_1, discount, price, n, call);
+		break;
+	case AVX2:
+		prices_avx2(strike, vol, forward, t_1, discount, price, n, call);
+		break;
+	case SSE2:
+		prices_sse2(strike, vol, forward, t_1, discount, price, n, call);
+		break;
+	default:
+		prices_scalar(strike, vol, forward, t_1, discount, price, n, call);
+	}
+}
+
+
+/**
+* Scalar reference kernel using the libm erfc, one optionlet at a time.
+*/
+void Black_Simd::prices_scalar(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n, const bool& call)
+{
+	for (std::size_t i = 0; i < n; i++)
+	{
+		price[i] = discount[i] * black_value(forward[i], strike[i], vol[i] * sqrt(t_1[i] / 365.), call);
+	}
+}
+
+
+/**
+* Scalar reference kernel for optionlet_values, one optionlet at a time.
+*/
+void Black_Simd::values_scalar(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n)
+{
+	for (std::size_t i = 0; i < n; i++)
+	{
+		double std_dev = vol[i] * sqrt(t_1[i] / 365.);
+		double d1, d2;
+		black_d(forward[i], strike[i], std_dev, d1, d2);
+		double n_d1, n_minus_d1, n_d2, n_minus_d2;
+		Libm_Normal::cdf_pair(d1, n_d1, n_minus_d1);
+		Libm_Normal::cdf_pair(d2, n_d2, n_minus_d2);
+		cap[i] = discount[i] * black_combine(forward[i], strike[i], n_d1, n_d2, true);
+		floor[i] = discount[i] * black_combine(forward[i], strike[i], n_minus_d1, n_minus_d2, false); // not by parity, which cancels out of the money
+		digital_cap[i] = discount[i] * n_d2;
+		digital_floor[i] = discount[i] * n_minus_d2;
+	}
+}
+
+
+/**
+* Scalar reference kernel for exponentials using the libm exp.
+*/
+void Black_Simd::exponentials_scalar(const double* x, double* result, const std::size_t& n)
+{
+	for (std::size_t i = 0; i < n; i++)
+	{
+		result[i] = exp(x[i]);
+	}
+}
+
+
+/**
+* Scalar kernel in single precision using the libm erfc, one optionlet at a time.
+*/
+void Black_Simd::prices_scalar(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n, const bool& call)
+{
+	for (std::size_t i = 0; i < n; i++)
+	{
+		price[i] = discount[i] * black_value(forward[i], strike[i], vol[i] * std::sqrt(t_1[i] / 365.f), call);
+	}
+}
+
+
+/**
+* Scalar kernel for exponentials in single precision using the libm exp.
+*/
+void Black_Simd::exponentials_scalar(const float* x, float* result, const std::size_t& n)
+{
+	for (std::size_t i = 0; i < n; i++)
+	{
+		result[i] = std::exp(x[i]);
+	}
+}
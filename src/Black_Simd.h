@@ -0,0 +1,58 @@
+#pragma once
+#include <cstddef>
+
+
+/**
+* Project:    Project 1
+* Filename:   Black_Simd.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Vectorised Black kernels for caplets and floorlets with runtime instruction set selection.
+*/
+class Black_Simd
+{
+public:
+	enum Instruction_Set { Scalar = 0, SSE2 = 1, AVX2 = 2, AVX512 = 3 };
+
+	// Kernels operating on caller-owned contiguous arrays of length n (see Optionlet_Batch.h)
+	static void caplet_prices(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n);
+	static void floorlet_prices(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n);
+	static void exponentials(const double* x, double* result, const std::size_t& n); // result[i] = exp(x[i]), e.g. discount factors
+	static void optionlet_values(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n); // caplet, floorlet and digital values in one pass
+
+	// Single precision kernels, twice the lanes per instruction (see Mixed_Precision.h for their error)
+	static void caplet_prices(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n);
+	static void floorlet_prices(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n);
+	static void exponentials(const float* x, float* result, const std::size_t& n);
+
+	// Instruction set selection
+	static Instruction_Set get_supported_instruction_set(); // best set supported by the running CPU
+	static Instruction_Set get_instruction_set(); // set currently used by the kernels
+	static void set_instruction_set(const Instruction_Set& requested); // capped at the supported set
+	static const char* get_instruction_set_name(const Instruction_Set& set);
+
+private:
+	// Implemented in Black_Simd.cpp, Black_Simd_Sse2.cpp, Black_Simd_Avx2.cpp and Black_Simd_Avx512.cpp
+	static void prices_scalar(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n, const bool& call);
+	static void prices_sse2(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n, const bool& call);
+	static void prices_avx2(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n, const bool& call);
+	static void prices_avx512(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n, const bool& call);
+	static void prices(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n, const bool& call);
+	static void values_scalar(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n);
+	static void values_sse2(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n);
+	static void values_avx2(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n);
+	static void exponentials_scalar(const double* x, double* result, const std::size_t& n);
+	static void exponentials_sse2(const double* x, double* result, const std::size_t& n);
+	static void exponentials_avx2(const double* x, double* result, const std::size_t& n);
+	static void exponentials_avx512(const double* x, double* result, const std::size_t& n);
+	static void values_avx512(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n);
+	static void prices_scalar(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n, const bool& call);
+	static void prices_sse2(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n, const bool& call);
+	static void prices_avx2(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n, const bool& call);
+	static void prices_avx512(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n, const bool& call);
+	static void prices(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n, const bool& call);
+	static void exponentials_scalar(const float* x, float* result, const std::size_t& n);
+	static void exponentials_sse2(const float* x, float* result, const std::size_t& n);
+	static void exponentials_avx2(const float* x, float* result, const std::size_t& n);
+	static void exponentials_avx512(const float* x, float* result, const std::size_t& n);
+};
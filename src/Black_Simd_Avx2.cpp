@@ -0,0 +1,235 @@
+#include "Black_Simd.h"
+#include <cmath>
+#include <cstddef>
+
+
+/**
+* Project:    Project 1
+* Filename:   Black_Simd_Avx2.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    AVX2/FMA Black kernel pricing 4 optionlets (8 in single precision) per instruction.
+*/
+
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+
+// Only the functions below are compiled for AVX2, they are only called once the CPU has been checked.
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2,fma"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#endif
+#include <immintrin.h>
+
+
+namespace
+{
+	/**
+	* Four double precision lanes held in one AVX register.
+	*/
+	struct Lane_Avx2
+	{
+		typedef double Scalar;
+		typedef __m256d Mask;
+		static constexpr std::size_t width = 4;
+		__m256d v;
+
+		Lane_Avx2() : v(_mm256_setzero_pd()) {}
+		Lane_Avx2(const __m256d& x) : v(x) {}
+		Lane_Avx2(const double& x) : v(_mm256_set1_pd(x)) {}
+		static Lane_Avx2 load(const double* p) { return _mm256_loadu_pd(p); }
+		void store(double* p) const { _mm256_storeu_pd(p, v); }
+	};
+
+	inline Lane_Avx2 operator+(const Lane_Avx2& a, const Lane_Avx2& b) { return _mm256_add_pd(a.v, b.v); }
+	inline Lane_Avx2 operator-(const Lane_Avx2& a, const Lane_Avx2& b) { return _mm256_sub_pd(a.v, b.v); }
+	inline Lane_Avx2 operator*(const Lane_Avx2& a, const Lane_Avx2& b) { return _mm256_mul_pd(a.v, b.v); }
+	inline Lane_Avx2 operator/(const Lane_Avx2& a, const Lane_Avx2& b) { return _mm256_div_pd(a.v, b.v); }
+	inline Lane_Avx2 fmadd(const Lane_Avx2& a, const Lane_Avx2& b, const Lane_Avx2& c) { return _mm256_fmadd_pd(a.v, b.v, c.v); }
+	inline Lane_Avx2 vmin(const Lane_Avx2& a, const Lane_Avx2& b) { return _mm256_min_pd(a.v, b.v); }
+	inline Lane_Avx2 vmax(const Lane_Avx2& a, const Lane_Avx2& b) { return _mm256_max_pd(a.v, b.v); }
+	inline Lane_Avx2 vabs(const Lane_Avx2& a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v); }
+	inline Lane_Avx2 vsqrt(const Lane_Avx2& a) { return _mm256_sqrt_pd(a.v); }
+	inline __m256d cmp_lt(const Lane_Avx2& a, const Lane_Avx2& b) { return _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ); }
+	inline Lane_Avx2 select(const __m256d& mask, const Lane_Avx2& a, const Lane_Avx2& b) { return _mm256_blendv_pd(b.v, a.v, mask); }
+	inline bool any_lane(const __m256d& mask) { return _mm256_movemask_pd(mask) != 0; }
+	inline Lane_Avx2 round_nearest(const Lane_Avx2& a) { return _mm256_round_pd(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+	/**
+	* Function to build 2^n from integral valued lanes n in [-1022, 1023].
+	*/
+	inline Lane_Avx2 pow2n(const Lane_Avx2& n)
+	{
+		__m256i bits = _mm256_castpd_si256(_mm256_add_pd(n.v, _mm256_set1_pd(6755399441055744.0))); // n in the low bits of 1.5*2^52 + n
+		bits = _mm256_add_epi64(bits, _mm256_set1_epi64x(1023));
+		return _mm256_castsi256_pd(_mm256_slli_epi64(bits, 52));
+	}
+
+	/**
+	* Function to split positive normal lanes x into m 2^e with m in [0.5, 1).
+	*/
+	inline Lane_Avx2 frexp_v(const Lane_Avx2& x, Lane_Avx2& e)
+	{
+		__m256i bits = _mm256_castpd_si256(x.v);
+		__m256i biased = _mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_castpd_si256(_mm256_set1_pd(4503599627370496.0))); // 2^52 + biased exponent
+		e = _mm256_sub_pd(_mm256_castsi256_pd(biased), _mm256_set1_pd(4503599627370496.0 + 1022.0));
+		__m256i mantissa = _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)), _mm256_set1_epi64x(0x3FE0000000000000LL));
+		return _mm256_castsi256_pd(mantissa);
+	}
+
+	/**
+	* Eight single precision lanes held in one AVX register.
+	*/
+	struct Lane_Avx2_Float
+	{
+		typedef float Scalar;
+		typedef __m256 Mask;
+		static constexpr std::size_t width = 8;
+		__m256 v;
+
+		Lane_Avx2_Float() : v(_mm256_setzero_ps()) {}
+		Lane_Avx2_Float(const __m256& x) : v(x) {}
+		Lane_Avx2_Float(const float& x) : v(_mm256_set1_ps(x)) {}
+		static Lane_Avx2_Float load(const float* p) { return _mm256_loadu_ps(p); }
+		void store(float* p) const { _mm256_storeu_ps(p, v); }
+	};
+
+	inline Lane_Avx2_Float operator+(const Lane_Avx2_Float& a, const Lane_Avx2_Float& b) { return _mm256_add_ps(a.v, b.v); }
+	inline Lane_Avx2_Float operator-(const Lane_Avx2_Float& a, const Lane_Avx2_Float& b) { return _mm256_sub_ps(a.v, b.v); }
+	inline Lane_Avx2_Float operator*(const Lane_Avx2_Float& a, const Lane_Avx2_Float& b) { return _mm256_mul_ps(a.v, b.v); }
+	inline Lane_Avx2_Float operator/(const Lane_Avx2_Float& a, const Lane_Avx2_Float& b) { return _mm256_div_ps(a.v, b.v); }
+	inline Lane_Avx2_Float fmadd(const Lane_Avx2_Float& a, const Lane_Avx2_Float& b, const Lane_Avx2_Float& c) { return _mm256_fmadd_ps(a.v, b.v, c.v); }
+	inline Lane_Avx2_Float vmin(const Lane_Avx2_Float& a, const Lane_Avx2_Float& b) { return _mm256_min_ps(a.v, b.v); }
+	inline Lane_Avx2_Float vmax(const Lane_Avx2_Float& a, const Lane_Avx2_Float& b) { return _mm256_max_ps(a.v, b.v); }
+	inline Lane_Avx2_Float vabs(const Lane_Avx2_Float& a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v); }
+	inline Lane_Avx2_Float vsqrt(const Lane_Avx2_Float& a) { return _mm256_sqrt_ps(a.v); }
+	inline __m256 cmp_lt(const Lane_Avx2_Float& a, const Lane_Avx2_Float& b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ); }
+	inline Lane_Avx2_Float select(const __m256& mask, const Lane_Avx2_Float& a, const Lane_Avx2_Float& b) { return _mm256_blendv_ps(b.v, a.v, mask); }
+	inline bool any_lane(const __m256& mask) { return _mm256_movemask_ps(mask) != 0; }
+	inline Lane_Avx2_Float round_nearest(const Lane_Avx2_Float& a) { return _mm256_round_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+	/**
+	* Function to build 2^n from integral valued lanes n in [-126, 127].
+	*/
+	inline Lane_Avx2_Float pow2n(const Lane_Avx2_Float& n)
+	{
+		__m256i bits = _mm256_castps_si256(_mm256_add_ps(n.v, _mm256_set1_ps(12582912.0f))); // n in the low bits of 1.5*2^23 + n
+		bits = _mm256_add_epi32(bits, _mm256_set1_epi32(127));
+		return _mm256_castsi256_ps(_mm256_slli_epi32(bits, 23));
+	}
+
+	/**
+	* Function to split positive normal lanes x into m 2^e with m in [0.5, 1).
+	*/
+	inline Lane_Avx2_Float frexp_v(const Lane_Avx2_Float& x, Lane_Avx2_Float& e)
+	{
+		__m256i bits = _mm256_castps_si256(x.v);
+		__m256i biased = _mm256_or_si256(_mm256_srli_epi32(bits, 23), _mm256_castps_si256(_mm256_set1_ps(8388608.0f))); // 2^23 + biased exponent
+		e = _mm256_sub_ps(_mm256_castsi256_ps(biased), _mm256_set1_ps(8388608.0f + 126.0f));
+		__m256i mantissa = _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F000000));
+		return _mm256_castsi256_ps(mantissa);
+	}
+}
+
+#include "Simd_Math.h"
+
+
+/**
+* AVX2 kernel, see Black_Simd::caplet_prices.
+*/
+void Black_Simd::prices_avx2(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n, const bool& call)
+{
+	simd_black_prices<Lane_Avx2>(strike, vol, forward, t_1, discount, price, n, call);
+}
+
+
+/**
+* AVX2 kernel, see Black_Simd::optionlet_values.
+*/
+void Black_Simd::values_avx2(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n)
+{
+	simd_black_values<Lane_Avx2>(strike, vol, forward, t_1, discount, cap, floor, digital_cap, digital_floor, n);
+}
+
+
+/**
+* AVX2 kernel, see Black_Simd::exponentials.
+*/
+void Black_Simd::exponentials_avx2(const double* x, double* result, const std::size_t& n)
+{
+	simd_exp_values<Lane_Avx2>(x, result, n);
+}
+
+
+/**
+* AVX2 kernel in single precision, see Black_Simd::caplet_prices.
+*/
+void Black_Simd::prices_avx2(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n, const bool& call)
+{
+	simd_black_prices<Lane_Avx2_Float>(strike, vol, forward, t_1, discount, price, n, call);
+}
+
+
+/**
+* AVX2 kernel in single precision, see Black_Simd::exponentials.
+*/
+void Black_Simd::exponentials_avx2(const float* x, float* result, const std::size_t& n)
+{
+	simd_exp_values<Lane_Avx2_Float>(x, result, n);
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#else
+
+/**
+* AVX2 is unavailable on this architecture, see Black_Simd::caplet_prices.
+*/
+void Black_Simd::prices_avx2(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n, const bool& call)
+{
+	prices_scalar(strike, vol, forward, t_1, discount, price, n, call);
+}
+
+
+/**
+* See prices_avx2.
+*/
+void Black_Simd::values_avx2(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n)
+{
+	values_scalar(strike, vol, forward, t_1, discount, cap, floor, digital_cap, digital_floor, n);
+}
+
+
+/**
+* See prices_avx2.
+*/
+void Black_Simd::exponentials_avx2(const double* x, double* result, const std::size_t& n)
+{
+	exponentials_scalar(x, result, n);
+}
+
+
+/**
+* See prices_avx2.
+*/
+void Black_Simd::prices_avx2(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n, const bool& call)
+{
+	prices_scalar(strike, vol, forward, t_1, discount, price, n, call);
+}
+
+
+/**
+* See prices_avx2.
+*/
+void Black_Simd::exponentials_avx2(const float* x, float* result, const std::size_t& n)
+{
+	exponentials_scalar(x, result, n);
+}
+
+#endif
@@ -0,0 +1,235 @@
+#include "Black_Simd.h"
+#include <cmath>
+#include <cstddef>
+
+
+/**
+* Project:    Project 1
+* Filename:   Black_Simd_Avx512.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    AVX-512 Black kernel pricing 8 optionlets (16 in single precision) per instruction.
+*/
+
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+// Only the functions below are compiled for AVX-512F, they are only called once the CPU has been checked.
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx512f"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#endif
+#include <immintrin.h>
+
+
+namespace
+{
+	/**
+	* Eight double precision lanes held in one ZMM register.
+	*/
+	struct Lane_Avx512
+	{
+		typedef double Scalar;
+		typedef __mmask8 Mask;
+		static constexpr std::size_t width = 8;
+		__m512d v;
+
+		Lane_Avx512() : v(_mm512_setzero_pd()) {}
+		Lane_Avx512(const __m512d& x) : v(x) {}
+		Lane_Avx512(const double& x) : v(_mm512_set1_pd(x)) {}
+		static Lane_Avx512 load(const double* p) { return _mm512_loadu_pd(p); }
+		void store(double* p) const { _mm512_storeu_pd(p, v); }
+	};
+
+	inline Lane_Avx512 operator+(const Lane_Avx512& a, const Lane_Avx512& b) { return _mm512_add_pd(a.v, b.v); }
+	inline Lane_Avx512 operator-(const Lane_Avx512& a, const Lane_Avx512& b) { return _mm512_sub_pd(a.v, b.v); }
+	inline Lane_Avx512 operator*(const Lane_Avx512& a, const Lane_Avx512& b) { return _mm512_mul_pd(a.v, b.v); }
+	inline Lane_Avx512 operator/(const Lane_Avx512& a, const Lane_Avx512& b) { return _mm512_div_pd(a.v, b.v); }
+	inline Lane_Avx512 fmadd(const Lane_Avx512& a, const Lane_Avx512& b, const Lane_Avx512& c) { return _mm512_fmadd_pd(a.v, b.v, c.v); }
+	inline Lane_Avx512 vmin(const Lane_Avx512& a, const Lane_Avx512& b) { return _mm512_min_pd(a.v, b.v); }
+	inline Lane_Avx512 vmax(const Lane_Avx512& a, const Lane_Avx512& b) { return _mm512_max_pd(a.v, b.v); }
+	inline Lane_Avx512 vabs(const Lane_Avx512& a) { return _mm512_abs_pd(a.v); }
+	inline Lane_Avx512 vsqrt(const Lane_Avx512& a) { return _mm512_sqrt_pd(a.v); }
+	inline __mmask8 cmp_lt(const Lane_Avx512& a, const Lane_Avx512& b) { return _mm512_cmp_pd_mask(a.v, b.v, _CMP_LT_OQ); }
+	inline Lane_Avx512 select(const __mmask8& mask, const Lane_Avx512& a, const Lane_Avx512& b) { return _mm512_mask_blend_pd(mask, b.v, a.v); }
+	inline bool any_lane(const __mmask8& mask) { return mask != 0; }
+	inline Lane_Avx512 round_nearest(const Lane_Avx512& a) { return _mm512_roundscale_pd(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+	/**
+	* Function to build 2^n from integral valued lanes n in [-1022, 1023].
+	*/
+	inline Lane_Avx512 pow2n(const Lane_Avx512& n)
+	{
+		__m512i bits = _mm512_castpd_si512(_mm512_add_pd(n.v, _mm512_set1_pd(6755399441055744.0))); // n in the low bits of 1.5*2^52 + n
+		bits = _mm512_add_epi64(bits, _mm512_set1_epi64(1023));
+		return _mm512_castsi512_pd(_mm512_slli_epi64(bits, 52));
+	}
+
+	/**
+	* Function to split positive normal lanes x into m 2^e with m in [0.5, 1).
+	*/
+	inline Lane_Avx512 frexp_v(const Lane_Avx512& x, Lane_Avx512& e)
+	{
+		__m512i bits = _mm512_castpd_si512(x.v);
+		__m512i biased = _mm512_or_si512(_mm512_srli_epi64(bits, 52), _mm512_castpd_si512(_mm512_set1_pd(4503599627370496.0))); // 2^52 + biased exponent
+		e = _mm512_sub_pd(_mm512_castsi512_pd(biased), _mm512_set1_pd(4503599627370496.0 + 1022.0));
+		__m512i mantissa = _mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi64(0x000FFFFFFFFFFFFFLL)), _mm512_set1_epi64(0x3FE0000000000000LL));
+		return _mm512_castsi512_pd(mantissa);
+	}
+
+	/**
+	* Sixteen single precision lanes held in one ZMM register.
+	*/
+	struct Lane_Avx512_Float
+	{
+		typedef float Scalar;
+		typedef __mmask16 Mask;
+		static constexpr std::size_t width = 16;
+		__m512 v;
+
+		Lane_Avx512_Float() : v(_mm512_setzero_ps()) {}
+		Lane_Avx512_Float(const __m512& x) : v(x) {}
+		Lane_Avx512_Float(const float& x) : v(_mm512_set1_ps(x)) {}
+		static Lane_Avx512_Float load(const float* p) { return _mm512_loadu_ps(p); }
+		void store(float* p) const { _mm512_storeu_ps(p, v); }
+	};
+
+	inline Lane_Avx512_Float operator+(const Lane_Avx512_Float& a, const Lane_Avx512_Float& b) { return _mm512_add_ps(a.v, b.v); }
+	inline Lane_Avx512_Float operator-(const Lane_Avx512_Float& a, const Lane_Avx512_Float& b) { return _mm512_sub_ps(a.v, b.v); }
+	inline Lane_Avx512_Float operator*(const Lane_Avx512_Float& a, const Lane_Avx512_Float& b) { return _mm512_mul_ps(a.v, b.v); }
+	inline Lane_Avx512_Float operator/(const Lane_Avx512_Float& a, const Lane_Avx512_Float& b) { return _mm512_div_ps(a.v, b.v); }
+	inline Lane_Avx512_Float fmadd(const Lane_Avx512_Float& a, const Lane_Avx512_Float& b, const Lane_Avx512_Float& c) { return _mm512_fmadd_ps(a.v, b.v, c.v); }
+	inline Lane_Avx512_Float vmin(const Lane_Avx512_Float& a, const Lane_Avx512_Float& b) { return _mm512_min_ps(a.v, b.v); }
+	inline Lane_Avx512_Float vmax(const Lane_Avx512_Float& a, const Lane_Avx512_Float& b) { return _mm512_max_ps(a.v, b.v); }
+	inline Lane_Avx512_Float vabs(const Lane_Avx512_Float& a) { return _mm512_abs_ps(a.v); }
+	inline Lane_Avx512_Float vsqrt(const Lane_Avx512_Float& a) { return _mm512_sqrt_ps(a.v); }
+	inline __mmask16 cmp_lt(const Lane_Avx512_Float& a, const Lane_Avx512_Float& b) { return _mm512_cmp_ps_mask(a.v, b.v, _CMP_LT_OQ); }
+	inline Lane_Avx512_Float select(const __mmask16& mask, const Lane_Avx512_Float& a, const Lane_Avx512_Float& b) { return _mm512_mask_blend_ps(mask, b.v, a.v); }
+	inline bool any_lane(const __mmask16& mask) { return mask != 0; }
+	inline Lane_Avx512_Float round_nearest(const Lane_Avx512_Float& a) { return _mm512_roundscale_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+	/**
+	* Function to build 2^n from integral valued lanes n in [-126, 127].
+	*/
+	inline Lane_Avx512_Float pow2n(const Lane_Avx512_Float& n)
+	{
+		__m512i bits = _mm512_castps_si512(_mm512_add_ps(n.v, _mm512_set1_ps(12582912.0f))); // n in the low bits of 1.5*2^23 + n
+		bits = _mm512_add_epi32(bits, _mm512_set1_epi32(127));
+		return _mm512_castsi512_ps(_mm512_slli_epi32(bits, 23));
+	}
+
+	/**
+	* Function to split positive normal lanes x into m 2^e with m in [0.5, 1).
+	*/
+	inline Lane_Avx512_Float frexp_v(const Lane_Avx512_Float& x, Lane_Avx512_Float& e)
+	{
+		__m512i bits = _mm512_castps_si512(x.v);
+		__m512i biased = _mm512_or_si512(_mm512_srli_epi32(bits, 23), _mm512_castps_si512(_mm512_set1_ps(8388608.0f))); // 2^23 + biased exponent
+		e = _mm512_sub_ps(_mm512_castsi512_ps(biased), _mm512_set1_ps(8388608.0f + 126.0f));
+		__m512i mantissa = _mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi32(0x007FFFFF)), _mm512_set1_epi32(0x3F000000));
+		return _mm512_castsi512_ps(mantissa);
+	}
+}
+
+#include "Simd_Math.h"
+
+
+/**
+* AVX-512 kernel, see Black_Simd::caplet_prices.
+*/
+void Black_Simd::prices_avx512(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n, const bool& call)
+{
+	simd_black_prices<Lane_Avx512>(strike, vol, forward, t_1, discount, price, n, call);
+}
+
+
+/**
+* AVX-512 kernel, see Black_Simd::optionlet_values.
+*/
+void Black_Simd::values_avx512(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n)
+{
+	simd_black_values<Lane_Avx512>(strike, vol, forward, t_1, discount, cap, floor, digital_cap, digital_floor, n);
+}
+
+
+/**
+* AVX-512 kernel, see Black_Simd::exponentials.
+*/
+void Black_Simd::exponentials_avx512(const double* x, double* result, const std::size_t& n)
+{
+	simd_exp_values<Lane_Avx512>(x, result, n);
+}
+
+
+/**
+* AVX-512 kernel in single precision, see Black_Simd::caplet_prices.
+*/
+void Black_Simd::prices_avx512(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n, const bool& call)
+{
+	simd_black_prices<Lane_Avx512_Float>(strike, vol, forward, t_1, discount, price, n, call);
+}
+
+
+/**
+* AVX-512 kernel in single precision, see Black_Simd::exponentials.
+*/
+void Black_Simd::exponentials_avx512(const float* x, float* result, const std::size_t& n)
+{
+	simd_exp_values<Lane_Avx512_Float>(x, result, n);
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#else
+
+/**
+* AVX-512 is unavailable on this architecture, see Black_Simd::caplet_prices.
+*/
+void Black_Simd::prices_avx512(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n, const bool& call)
+{
+	prices_scalar(strike, vol, forward, t_1, discount, price, n, call);
+}
+
+
+/**
+* See prices_avx512.
+*/
+void Black_Simd::values_avx512(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n)
+{
+	values_scalar(strike, vol, forward, t_1, discount, cap, floor, digital_cap, digital_floor, n);
+}
+
+
+/**
+* See prices_avx512.
+*/
+void Black_Simd::exponentials_avx512(const double* x, double* result, const std::size_t& n)
+{
+	exponentials_scalar(x, result, n);
+}
+
+
+/**
+* See prices_avx512.
+*/
+void Black_Simd::prices_avx512(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n, const bool& call)
+{
+	prices_scalar(strike, vol, forward, t_1, discount, price, n, call);
+}
+
+
+/**
+* See prices_avx512.
+*/
+void Black_Simd::exponentials_avx512(const float* x, float* result, const std::size_t& n)
+{
+	exponentials_scalar(x, result, n);
+}
+
+#endif
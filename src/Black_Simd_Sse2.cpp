@@ -0,0 +1,250 @@
+#include "Black_Simd.h"
+#include <cmath>
+#include <cstddef>
+
+
+/**
+* Project:    Project 1
+* Filename:   Black_Simd_Sse2.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    SSE2 Black kernel pricing 2 optionlets (4 in single precision) per instruction (fallback for older CPUs).
+*/
+
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+#include <emmintrin.h>
+
+
+namespace
+{
+	/**
+	* Two double precision lanes held in one SSE register.
+	*/
+	struct Lane_Sse2
+	{
+		typedef double Scalar;
+		typedef __m128d Mask;
+		static constexpr std::size_t width = 2;
+		__m128d v;
+
+		Lane_Sse2() : v(_mm_setzero_pd()) {}
+		Lane_Sse2(const __m128d& x) : v(x) {}
+		Lane_Sse2(const double& x) : v(_mm_set1_pd(x)) {}
+		static Lane_Sse2 load(const double* p) { return _mm_loadu_pd(p); }
+		void store(double* p) const { _mm_storeu_pd(p, v); }
+	};
+
+	inline Lane_Sse2 operator+(const Lane_Sse2& a, const Lane_Sse2& b) { return _mm_add_pd(a.v, b.v); }
+	inline Lane_Sse2 operator-(const Lane_Sse2& a, const Lane_Sse2& b) { return _mm_sub_pd(a.v, b.v); }
+	inline Lane_Sse2 operator*(const Lane_Sse2& a, const Lane_Sse2& b) { return _mm_mul_pd(a.v, b.v); }
+	inline Lane_Sse2 operator/(const Lane_Sse2& a, const Lane_Sse2& b) { return _mm_div_pd(a.v, b.v); }
+	inline Lane_Sse2 fmadd(const Lane_Sse2& a, const Lane_Sse2& b, const Lane_Sse2& c) { return _mm_add_pd(_mm_mul_pd(a.v, b.v), c.v); } // no FMA on SSE2
+	inline Lane_Sse2 vmin(const Lane_Sse2& a, const Lane_Sse2& b) { return _mm_min_pd(a.v, b.v); }
+	inline Lane_Sse2 vmax(const Lane_Sse2& a, const Lane_Sse2& b) { return _mm_max_pd(a.v, b.v); }
+	inline Lane_Sse2 vabs(const Lane_Sse2& a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a.v); }
+	inline Lane_Sse2 vsqrt(const Lane_Sse2& a) { return _mm_sqrt_pd(a.v); }
+	inline __m128d cmp_lt(const Lane_Sse2& a, const Lane_Sse2& b) { return _mm_cmplt_pd(a.v, b.v); }
+	inline Lane_Sse2 select(const __m128d& mask, const Lane_Sse2& a, const Lane_Sse2& b) { return _mm_or_pd(_mm_and_pd(mask, a.v), _mm_andnot_pd(mask, b.v)); }
+	inline bool any_lane(const __m128d& mask) { return _mm_movemask_pd(mask) != 0; }
+
+	/**
+	* Function to round lanes with |a| < 2^51 to the nearest integer (SSE2 has no round instruction).
+	*/
+	inline Lane_Sse2 round_nearest(const Lane_Sse2& a)
+	{
+		__m128d magic = _mm_set1_pd(6755399441055744.0); // 1.5*2^52
+		return _mm_sub_pd(_mm_add_pd(a.v, magic), magic);
+	}
+
+	/**
+	* Function to build 2^n from integral valued lanes n in [-1022, 1023].
+	*/
+	inline Lane_Sse2 pow2n(const Lane_Sse2& n)
+	{
+		__m128i bits = _mm_castpd_si128(_mm_add_pd(n.v, _mm_set1_pd(6755399441055744.0))); // n in the low bits of 1.5*2^52 + n
+		bits = _mm_add_epi64(bits, _mm_set1_epi64x(1023));
+		return _mm_castsi128_pd(_mm_slli_epi64(bits, 52));
+	}
+
+	/**
+	* Function to split positive normal lanes x into m 2^e with m in [0.5, 1).
+	*/
+	inline Lane_Sse2 frexp_v(const Lane_Sse2& x, Lane_Sse2& e)
+	{
+		__m128i bits = _mm_castpd_si128(x.v);
+		__m128i biased = _mm_or_si128(_mm_srli_epi64(bits, 52), _mm_castpd_si128(_mm_set1_pd(4503599627370496.0))); // 2^52 + biased exponent
+		e = _mm_sub_pd(_mm_castsi128_pd(biased), _mm_set1_pd(4503599627370496.0 + 1022.0));
+		__m128i mantissa = _mm_or_si128(_mm_and_si128(bits, _mm_set1_epi64x(0x000FFFFFFFFFFFFFLL)), _mm_set1_epi64x(0x3FE0000000000000LL));
+		return _mm_castsi128_pd(mantissa);
+	}
+
+	/**
+	* Four single precision lanes held in one SSE register.
+	*/
+	struct Lane_Sse2_Float
+	{
+		typedef float Scalar;
+		typedef __m128 Mask;
+		static constexpr std::size_t width = 4;
+		__m128 v;
+
+		Lane_Sse2_Float() : v(_mm_setzero_ps()) {}
+		Lane_Sse2_Float(const __m128& x) : v(x) {}
+		Lane_Sse2_Float(const float& x) : v(_mm_set1_ps(x)) {}
+		static Lane_Sse2_Float load(const float* p) { return _mm_loadu_ps(p); }
+		void store(float* p) const { _mm_storeu_ps(p, v); }
+	};
+
+	inline Lane_Sse2_Float operator+(const Lane_Sse2_Float& a, const Lane_Sse2_Float& b) { return _mm_add_ps(a.v, b.v); }
+	inline Lane_Sse2_Float operator-(const Lane_Sse2_Float& a, const Lane_Sse2_Float& b) { return _mm_sub_ps(a.v, b.v); }
+	inline Lane_Sse2_Float operator*(const Lane_Sse2_Float& a, const Lane_Sse2_Float& b) { return _mm_mul_ps(a.v, b.v); }
+	inline Lane_Sse2_Float operator/(const Lane_Sse2_Float& a, const Lane_Sse2_Float& b) { return _mm_div_ps(a.v, b.v); }
+	inline Lane_Sse2_Float fmadd(const Lane_Sse2_Float& a, const Lane_Sse2_Float& b, const Lane_Sse2_Float& c) { return _mm_add_ps(_mm_mul_ps(a.v, b.v), c.v); } // no FMA on SSE2
+	inline Lane_Sse2_Float vmin(const Lane_Sse2_Float& a, const Lane_Sse2_Float& b) { return _mm_min_ps(a.v, b.v); }
+	inline Lane_Sse2_Float vmax(const Lane_Sse2_Float& a, const Lane_Sse2_Float& b) { return _mm_max_ps(a.v, b.v); }
+	inline Lane_Sse2_Float vabs(const Lane_Sse2_Float& a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v); }
+	inline Lane_Sse2_Float vsqrt(const Lane_Sse2_Float& a) { return _mm_sqrt_ps(a.v); }
+	inline __m128 cmp_lt(const Lane_Sse2_Float& a, const Lane_Sse2_Float& b) { return _mm_cmplt_ps(a.v, b.v); }
+	inline Lane_Sse2_Float select(const __m128& mask, const Lane_Sse2_Float& a, const Lane_Sse2_Float& b) { return _mm_or_ps(_mm_and_ps(mask, a.v), _mm_andnot_ps(mask, b.v)); }
+	inline bool any_lane(const __m128& mask) { return _mm_movemask_ps(mask) != 0; }
+
+	/**
+	* Function to round lanes with |a| < 2^22 to the nearest integer.
+	*/
+	inline Lane_Sse2_Float round_nearest(const Lane_Sse2_Float& a)
+	{
+		__m128 magic = _mm_set1_ps(12582912.0f); // 1.5*2^23
+		return _mm_sub_ps(_mm_add_ps(a.v, magic), magic);
+	}
+
+	/**
+	* Function to build 2^n from integral valued lanes n in [-126, 127].
+	*/
+	inline Lane_Sse2_Float pow2n(const Lane_Sse2_Float& n)
+	{
+		__m128i bits = _mm_castps_si128(_mm_add_ps(n.v, _mm_set1_ps(12582912.0f))); // n in the low bits of 1.5*2^23 + n
+		bits = _mm_add_epi32(bits, _mm_set1_epi32(127));
+		return _mm_castsi128_ps(_mm_slli_epi32(bits, 23));
+	}
+
+	/**
+	* Function to split positive normal lanes x into m 2^e with m in [0.5, 1).
+	*/
+	inline Lane_Sse2_Float frexp_v(const Lane_Sse2_Float& x, Lane_Sse2_Float& e)
+	{
+		__m128i bits = _mm_castps_si128(x.v);
+		__m128i biased = _mm_or_si128(_mm_srli_epi32(bits, 23), _mm_castps_si128(_mm_set1_ps(8388608.0f))); // 2^23 + biased exponent
+		e = _mm_sub_ps(_mm_castsi128_ps(biased), _mm_set1_ps(8388608.0f + 126.0f));
+		__m128i mantissa = _mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F000000));
+		return _mm_castsi128_ps(mantissa);
+	}
+}
+
+#include "Simd_Math.h"
+
+
+/**
+* SSE2 kernel, see Black_Simd::caplet_prices.
+*/
+void Black_Simd::prices_sse2(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n, const bool& call)
+{
+	simd_black_prices<Lane_Sse2>(strike, vol, forward, t_1, discount, price, n, call);
+}
+
+
+/**
+* SSE2 kernel, see Black_Simd::optionlet_values.
+*/
+void Black_Simd::values_sse2(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n)
+{
+	simd_black_values<Lane_Sse2>(strike, vol, forward, t_1, discount, cap, floor, digital_cap, digital_floor, n);
+}
+
+
+/**
+* SSE2 kernel, see Black_Simd::exponentials.
+*/
+void Black_Simd::exponentials_sse2(const double* x, double* result, const std::size_t& n)
+{
+	simd_exp_values<Lane_Sse2>(x, result, n);
+}
+
+
+/**
+* SSE2 kernel in single precision, see Black_Simd::caplet_prices.
+*/
+void Black_Simd::prices_sse2(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n, const bool& call)
+{
+	simd_black_prices<Lane_Sse2_Float>(strike, vol, forward, t_1, discount, price, n, call);
+}
+
+
+/**
+* SSE2 kernel in single precision, see Black_Simd::exponentials.
+*/
+void Black_Simd::exponentials_sse2(const float* x, float* result, const std::size_t& n)
+{
+	simd_exp_values<Lane_Sse2_Float>(x, result, n);
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#else
+
+/**
+* SSE2 is unavailable on this architecture, see Black_Simd::caplet_prices.
+*/
+void Black_Simd::prices_sse2(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n, const bool& call)
+{
+	prices_scalar(strike, vol, forward, t_1, discount, price, n, call);
+}
+
+
+/**
+* See prices_sse2.
+*/
+void Black_Simd::values_sse2(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n)
+{
+	values_scalar(strike, vol, forward, t_1, discount, cap, floor, digital_cap, digital_floor, n);
+}
+
+
+/**
+* See prices_sse2.
+*/
+void Black_Simd::exponentials_sse2(const double* x, double* result, const std::size_t& n)
+{
+	exponentials_scalar(x, result, n);
+}
+
+
+/**
+* See prices_sse2.
+*/
+void Black_Simd::prices_sse2(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, float* price, const std::size_t& n, const bool& call)
+{
+	prices_scalar(strike, vol, forward, t_1, discount, price, n, call);
+}
+
+
+/**
+* See prices_sse2.
+*/
+void Black_Simd::exponentials_sse2(const float* x, float* result, const std::size_t& n)
+{
+	exponentials_scalar(x, result, n);
+}
+
+#endif
@@ -1,4 +1,6 @@
 #include "Bond.h"
+#include "Hot_Path_Counters.h"
+#include <cmath>
 #include <iostream>
 
 /**
@@ -61,6 +63,7 @@ Bond::Bond(const float& princpal, const float& interest_rate, const unsigned int
 	maturity = expiry;
 	principal = princpal;
 	interest_rates.at(0) = interest_rate;
+	yield_guess = interest_rate;
 	zero_coupon = true;
 }
 
@@ -91,6 +94,30 @@ float Bond::get_price(const std::vector<float>& interests, const unsigned int& e
 	return bond_value;
 }
 
+/**
+* Function to return the fair price of a bond to the user (ZCB or coupon-paying), reading the rates from
+* the caller's array. Unlike the vector overload the rates are not kept, so get_price() afterwards
+* still uses the rates last stored.
+* @param interests const float pointer, denotes the interest rates at the time of each
+*        coupon (for ZCB the last rate is used).
+* @param n_rates const size_t reference, denotes the number of rates.
+* @param expiry const const unsigned int reference, denotes the expiry date of the bond.
+*/
+float Bond::get_price(const float* interests, const std::size_t& n_rates, const unsigned int& expiry)
+{
+	for (std::size_t i = 0; i < n_rates; i++)
+	{
+		if (interests[i] > 1)
+		{
+			throw 2; // Make sure all of the interest rates are expressed as decimals i.e. 5.8% -> 0.058
+		}
+	}
+	maturity = expiry;
+	discount(interests, n_rates);
+	float bond_value = float(bond_price); // Calculate the bond price
+	return bond_value;
+}
+
 /**
 * Function to return the fair price of a bond to the user (ZCB or coupon-paying)
 */
@@ -101,13 +128,58 @@ float Bond::get_price()
 	return bond_value;
 }
 
+/**
+* Function to return the fair price of a bond (ZCB or coupon-paying) discounted off a shared zero curve.
+* The zero rate at each payment date is read from the curve, so later yield calls use the same rates.
+* @param curve const Discount_Curve reference, denotes the zero curve (interpolated at each payment date).
+*/
+float Bond::get_price(const Discount_Curve& curve)
+{
+	double value{ 0 };
+	if (zero_coupon)
+	{
+		interest_rates.assign(1, float(curve.get_zero_rate(maturity)));
+		value = principal * curve.get_discount_factor(maturity);
+	}
+	else {
+		interest_rates.resize(coupon_dates.size());
+		for (unsigned int i = 0; i < coupon_dates.size(); i++)
+		{
+			interest_rates.at(i) = float(curve.get_zero_rate(coupon_dates.at(i)));
+			value += coupons.at(i) * curve.get_discount_factor(coupon_dates.at(i)); // principal is last coupon
+		}
+	}
+	bond_price = value;
+
+	yield_guess = 0;
+	for (auto &r : interest_rates)
+	{
+		yield_guess += r;
+	}
+	yield_guess /= interest_rates.size();
+
+	float bond_value = float(bond_price);
+	return bond_value;
+}
+
 /**
 * Function to calculate the fair price of a bond to the user (ZCB or coupon-paying)
 */
 void Bond::price() 
+{
+	discount(interest_rates.data(), interest_rates.size());
+	return;
+}
+
+/**
+* Function to calculate the fair price of a bond from a set of rates (ZCB or coupon-paying)
+* @param rates const float pointer, denotes the interest rate at the time of each coupon (for ZCB the last rate is used).
+* @param n_rates const size_t reference, denotes the number of rates.
+*/
+void Bond::discount(const float* rates, const std::size_t& n_rates)
 {
 
-	if (!zero_coupon && interest_rates.size() != coupons.size())
+	if ((!zero_coupon && n_rates != coupons.size()) || n_rates == 0)
 	{
 		throw 3; // Check each coupon has a corresponding rate.
 	}
@@ -116,15 +188,19 @@ void Bond::price()
 	if (zero_coupon)
 	{
 		double t = maturity/double(365);
-		value = principal * exp(-1* interest_rates.at(interest_rates.size() - 1)*t); //ZCB just priced as principal, time discounted.
+		value = principal * exp(-1* rates[n_rates - 1]*t); //ZCB just priced as principal, time discounted.
+		yield_guess = rates[n_rates - 1];
 	}
 	else {
 
+		yield_guess = 0;
 		for (unsigned int i = 0; i < coupons.size(); i++)
 		{
 			double t = coupon_dates.at(i) / double(365);
-			value += coupons.at(i)*exp(-1 * interest_rates.at(i)*t); // discount all coupons (principal is last coupon)
+			value += coupons.at(i)*exp(-1 * rates[i]*t); // discount all coupons (principal is last coupon)
+			yield_guess += rates[i];
 		}
+		yield_guess /= n_rates;
 	}
 	
 	bond_price = value;
@@ -151,29 +227,25 @@ double true_price = bond_price; // The evaluation function f(x) = true_price - n
 //(THE QUALITY OF SOLUTION MAY BE SENSITIVE TO INITIAL GUESS)
 // Here we make an apriori guess that the yield is the arithmetic mean 
 // of the interest rates (this is a heuristic that works very well)
-double ytm{ 0 };
-
-for (unsigned int i = 0; i < interest_rates.size(); i++)
-{
-	ytm += interest_rates.at(i);
-}
-
-ytm /= interest_rates.size();
+double ytm = yield_guess; // set when the bond was priced
 
 
 // Start Numerical Iterations
 double error = 1; // Fractional error between numerical approximation to price and analytic result for price.
 double tolerance = 0.000000001; // Breakout tolerance, controls the number of iterations used
 double price_at_ytm{ 0 };
+int iterations{ 0 };
 
 std::cout << "Starting Numerical Solver for Bond Yield Approximation" << std::endl;
-while (abs(error) > tolerance) // make sure the yield produces an arbitrarily accurate value of the bond price
+while (fabs(error) > tolerance) // make sure the yield produces an arbitrarily accurate value of the bond price
 {
 	ytm = update_yield(ytm); // generate a new proposed yield value
+	iterations++;
 	price_at_ytm = get_price_at_yield(ytm);
 	error = ((price_at_ytm - true_price) / true_price);
 	std::cout << "True Price: " << true_price << " Current Price: " << price_at_ytm << " Yield Value: " << ytm << std::endl;
 }
+Hot_Path_Counters::record(Counter_Yield, iterations, !std::isfinite(ytm) || std::isnan(error), false);
 
 return float(ytm);
 }
@@ -210,7 +282,7 @@ double Bond::update_yield(const double& y)
 	double t_i{ 0 };
 	for (unsigned int i = 0; i < coupon_dates.size(); i++)
 	{
-		t_i = coupon_dates.at(i) / 365;
+		t_i = coupon_dates.at(i) / 365.;
 		dp_dy += coupons.at(i) * t_i * exp(-1 * y*t_i); //see https://en.wikipedia.org/wiki/Newton%27s_method
 	}
 
@@ -235,7 +307,7 @@ float Bond::get_ytm()
 		yield = ytm(); 
 	}
 	else {
-		yield = interest_rates.at(interest_rates.size() - 1); 
+		yield = yield_guess; 
 		// If the bond is a ZCB, Newton-Raphson is overkill- just return the 0 rate for when the principal is paid
 	}
 
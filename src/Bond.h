@@ -1,5 +1,7 @@
 #pragma once
 #include <vector>
+#include <cstddef>
+#include "Discount_Curve.h"
 
 
 /**
@@ -20,10 +22,12 @@ private:
 	std::vector<float> coupons{ 0 }; 
 	std::vector<unsigned int> coupon_dates{ 0 }; 
 	std::vector<float> interest_rates{ 0 };
+	double yield_guess{ 0 }; // mean of the rates of the last pricing, starting point of the yield solver
 	 
 	// Bond Methods
 	float ytm();  // computes yield to maturity for the bond
 	void price(); // computes the intrinsic value for the bond
+	void discount(const float* rates, const std::size_t& n_rates); // computes the intrinsic value from the rates given
 	double update_yield(const double& y); 
 	double get_price_at_yield(const double& y); 
 public:
@@ -36,7 +40,13 @@ public:
 
 	//Bond Methods
 	float get_price(const std::vector<float>& interests, const unsigned int& expiry); // coupon paying bond pricing
+	float get_price(const float* interests, const std::size_t& n_rates, const unsigned int& expiry); // same, reading the caller's rates in place
 	float get_price(); // ZCB pricing
+	float get_price(const Discount_Curve& curve); // pricing off a shared zero curve
 	float get_principal() { return principal; };
+	unsigned int get_maturity() { return maturity; };
+	bool is_zero_coupon() { return zero_coupon; };
+	const std::vector<float>& get_coupons() { return coupons; }; // last coupon includes the principal
+	const std::vector<unsigned int>& get_coupon_dates() { return coupon_dates; };
 	float get_ytm();
 };
@@ -0,0 +1,202 @@
+#include "Bond_Book.h"
+#include "Black_Simd.h"
+#include <algorithm>
+
+
+/**
+* Project:    Project 1
+* Filename:   Bond_Book.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Flat cashflow table for large books of bonds, priced in batch off a shared curve.
+*/
+
+
+/**
+* Constructor for an empty book.
+* @param resource memory_resource pointer, denotes where the cashflow table is allocated.
+*/
+Bond_Book::Bond_Book(std::pmr::memory_resource* resource)
+	: amounts(resource), times(resource), offsets(1, 0, resource), mapped_times(resource), cashflow_pillars(resource), lower_weights(resource), upper_weights(resource)
+{
+}
+
+
+/**
+* Function to reserve space ahead of adding bonds, so that building a large book does not reallocate.
+* @param n_bonds const size_t reference, denotes the expected number of bonds.
+* @param n_cashflows const size_t reference, denotes the expected total number of cashflows.
+*/
+void Bond_Book::reserve(const std::size_t& n_bonds, const std::size_t& n_cashflows)
+{
+	offsets.reserve(n_bonds + 1);
+	amounts.reserve(n_cashflows);
+	times.reserve(n_cashflows);
+}
+
+
+/**
+* Function to append the cashflows of a bond to the book (the principal of a ZCB is paid at maturity).
+* @param bond Bond reference, denotes the bond to add.
+* Returns the index of the bond in the book.
+*/
+std::size_t Bond_Book::add_bond(Bond& bond)
+{
+	if (bond.is_zero_coupon())
+	{
+		amounts.push_back(bond.get_principal());
+		times.push_back(bond.get_maturity());
+	}
+	else {
+		const std::vector<float>& coupons = bond.get_coupons();
+		const std::vector<unsigned int>& dates = bond.get_coupon_dates();
+		for (std::size_t i = 0; i < coupons.size(); i++)
+		{
+			amounts.push_back(coupons[i]); // principal is paid with the last coupon
+			times.push_back(dates[i]);
+		}
+	}
+	offsets.push_back(amounts.size());
+	mapped_times.clear(); // new cashflows need mapping onto the curve
+	return offsets.size() - 2;
+}
+
+
+/**
+* Function to append a bond given directly by its cashflows (principal included) to the book.
+* @param cashflows const vector double reference, denotes the amount of each cashflow.
+* @param payment_times const vector double reference, denotes the time (days) of each cashflow.
+* Returns the index of the bond in the book.
+*/
+std::size_t Bond_Book::add_bond(const std::vector<double>& cashflows, const std::vector<double>& payment_times)
+{
+	if (cashflows.size() != payment_times.size())
+	{
+		throw 3; // Check each cashflow is paid on a corresponding date.
+	}
+	for (std::size_t i = 0; i < cashflows.size(); i++)
+	{
+		if (payment_times[i] < 0)
+		{
+			throw 2;
+		}
+	}
+
+	amounts.insert(amounts.end(), cashflows.begin(), cashflows.end());
+	times.insert(times.end(), payment_times.begin(), payment_times.end());
+	offsets.push_back(amounts.size());
+	mapped_times.clear();
+	return offsets.size() - 2;
+}
+
+
+/**
+* Function to locate every cashflow on the pillars of a curve. With L_j = -log(P_j) = r_j t_j at each pillar,
+* the interpolation of Discount_Curve::get_discount_factor gives -log(P(t)) as a fixed linear combination of
+* at most two L_j, so the weights are computed once per set of pillar times and reused on every curve update.
+* @param curve const Discount_Curve reference, denotes the curve to map onto.
+*/
+void Bond_Book::map_to_curve(const Discount_Curve& curve)
+{
+	const std::pmr::vector<unsigned int>& pillars = curve.get_times();
+	if (pillars.empty())
+	{
+		throw 3;
+	}
+
+	std::size_t last = pillars.size() - 1;
+	cashflow_pillars.resize(times.size());
+	lower_weights.resize(times.size());
+	upper_weights.resize(times.size());
+	for (std::size_t c = 0; c < times.size(); c++)
+	{
+		double day = times[c];
+		if (day <= 0)
+		{
+			cashflow_pillars[c] = 0;
+			lower_weights[c] = 0;
+			upper_weights[c] = 0;
+		}
+		else if (day <= pillars[0] || day >= pillars[last])
+		{
+			std::size_t pillar = day <= pillars[0] ? 0 : last; // flat zero rate beyond the curve
+			cashflow_pillars[c] = (unsigned int)pillar;
+			lower_weights[c] = day / pillars[pillar];
+			upper_weights[c] = 0;
+		}
+		else {
+			std::size_t upper = std::upper_bound(pillars.begin(), pillars.end(), day, [](const double& d, const unsigned int& t) { return d < t; }) - pillars.begin();
+			double weight = (day - pillars[upper - 1]) / double(pillars[upper] - pillars[upper - 1]);
+			cashflow_pillars[c] = (unsigned int)(upper - 1);
+			lower_weights[c] = 1 - weight;
+			upper_weights[c] = weight;
+		}
+	}
+	mapped_times = pillars;
+}
+
+
+/**
+* Function to price every bond in the book off a shared curve. Each cashflow is discounted with one
+* gather of the pillar log discount factors and one vectorised exp (see Black_Simd::exponentials),
+* and the bonds are split across the threads of the pool.
+* @param curve const Discount_Curve reference, denotes the zero curve.
+* @param prices vector double reference, resized and filled with the price of each bond.
+* @param pool Thread_Pool reference, denotes the threads used for pricing.
+*/
+void Bond_Book::price(const Discount_Curve& curve, std::vector<double>& prices, Thread_Pool& pool)
+{
+	if (mapped_times != curve.get_times())
+	{
+		map_to_curve(curve);
+	}
+
+	// -log(P_j) at each pillar, padded so that the upper pillar of the last one can be read
+	std::size_t n_pillars = curve.size();
+	std::vector<double> log_discounts(n_pillars + 1, 0);
+	for (std::size_t j = 0; j < n_pillars; j++)
+	{
+		log_discounts[j] = curve.get_zero_rate_at_pillar(j) * (curve.get_time(j) / double(365));
+	}
+
+	prices.resize(size());
+	pool.parallel_for(size(), [&](std::size_t begin, std::size_t end)
+	{
+		std::size_t first = offsets[begin];
+		std::size_t n = offsets[end] - first;
+		std::vector<double> discounts(n);
+		for (std::size_t c = 0; c < n; c++)
+		{
+			std::size_t pillar = cashflow_pillars[first + c];
+			discounts[c] = -1 * (lower_weights[first + c] * log_discounts[pillar] + upper_weights[first + c] * log_discounts[pillar + 1]);
+		}
+		Black_Simd::exponentials(discounts.data(), discounts.data(), n);
+
+		for (std::size_t b = begin; b < end; b++)
+		{
+			double value = 0;
+			for (std::size_t c = offsets[b]; c < offsets[b + 1]; c++)
+			{
+				value += amounts[c] * discounts[c - first];
+			}
+			prices[b] = value;
+		}
+	}, 1024);
+}
+
+
+/**
+* Function to solve the yield to maturity of every bond in the book from its price (see Yield_Solver.cpp).
+* @param prices const vector double reference, denotes the price of each bond.
+* @param results vector Yield_Result reference, resized and filled with the outcome of each solve.
+* @param pool Thread_Pool reference, denotes the threads used for solving.
+*/
+void Bond_Book::solve_yields(const std::vector<double>& prices, std::vector<Yield_Result>& results, Thread_Pool& pool)
+{
+	if (prices.size() != size())
+	{
+		throw 3; // Check each bond has a corresponding price.
+	}
+	results.resize(size());
+	Yield_Solver::solve_batch(amounts.data(), times.data(), offsets.data(), size(), prices.data(), results.data(), pool);
+}
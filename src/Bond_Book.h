@@ -0,0 +1,59 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <memory_resource>
+#include "Bond.h"
+#include "Discount_Curve.h"
+#include "Thread_Pool.h"
+#include "Yield_Solver.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Bond_Book.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Flat cashflow table for large books of bonds, priced in batch off a shared curve.
+*
+* The table is allocated from the memory resource given on construction (e.g. a Pricing_Workspace), the default
+* heap resource otherwise.
+*/
+class Bond_Book
+{
+private:
+	// Attributes (bond b owns cashflows [offsets[b], offsets[b+1]))
+	std::pmr::vector<double> amounts;
+	std::pmr::vector<double> times; // days
+	std::pmr::vector<std::size_t> offsets;
+
+	// Position of each cashflow on the curve last priced against, -log(P) = lower_weight L[pillar] + upper_weight L[pillar+1]
+	std::pmr::vector<unsigned int> mapped_times; // pillar times of that curve
+	std::pmr::vector<unsigned int> cashflow_pillars;
+	std::pmr::vector<double> lower_weights;
+	std::pmr::vector<double> upper_weights;
+
+	// Methods
+	void map_to_curve(const Discount_Curve& curve);
+
+
+public:
+	// Constructor & Destructor
+	Bond_Book(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+	~Bond_Book() {};
+
+	// Building Methods
+	void reserve(const std::size_t& n_bonds, const std::size_t& n_cashflows);
+	std::size_t add_bond(Bond& bond);
+	std::size_t add_bond(const std::vector<double>& cashflows, const std::vector<double>& payment_times);
+
+	// Batch Pricing Methods
+	void price(const Discount_Curve& curve, std::vector<double>& prices, Thread_Pool& pool = Thread_Pool::shared());
+	void solve_yields(const std::vector<double>& prices, std::vector<Yield_Result>& results, Thread_Pool& pool = Thread_Pool::shared());
+
+	// Getter Methods
+	std::size_t size() { return offsets.size() - 1; };
+	std::size_t get_cashflow_count() { return amounts.size(); };
+	const std::pmr::vector<double>& get_amounts() { return amounts; };
+	const std::pmr::vector<double>& get_times() { return times; };
+	const std::pmr::vector<std::size_t>& get_offsets() { return offsets; };
+};
@@ -0,0 +1,269 @@
+#include "Cap_Floor_Book.h"
+#include "Optionlet_Batch.h"
+#include "Compounding.h"
+#include <algorithm>
+#include <cmath>
+
+
+/**
+* Project:    Project 1
+* Filename:   Cap_Floor_Book.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Mutable cap/floor book repricing only the optionlets affected by a rate or volatility update.
+*/
+
+
+/**
+* Constructor for a book of optionlets written on consecutive periods of a set of zero rates,
+* valued as caplets, floorlets and digitals (see Black_Simd::optionlet_values).
+* @param strike_prices const vector double reference, denotes the strike (or exercise) prices of the options.
+* @param vols const vector double reference, denotes the interest rate volatilities.
+* @param zero_rates const vector double reference, denotes the interest rates at each discrete time interval t_i.
+* @param times const vector usigned int reference, denotes the times at which each of the rates occurs.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param freq const int reference, denotes the compounding frequency.
+*/
+Cap_Floor_Book::Cap_Floor_Book(const std::vector<double>& strike_prices, const std::vector<double>& vols, const std::vector<double>& zero_rates, const std::vector<unsigned int>& times, const bool& continuous, const int& freq)
+{
+	std::size_t n_options = strike_prices.size();
+
+	if (vols.size() != n_options || zero_rates.size() != n_options + 1 || times.size() != n_options + 1)
+	{
+		throw 3; // Check that for N options, N + 1 rates and times, as well as, N strikes and volatilities have been given.
+	}
+
+	for (std::size_t i = 0; i < n_options; i++)
+	{
+		if (strike_prices[i] < 0. || vols[i] < 0.)
+		{
+			throw 2; // Ensure all parameters take reasonable values.
+		}
+	}
+
+	rates = zero_rates;
+	time_of_rates = times;
+	continuous_compounding = continuous;
+	compounding_frequency = freq;
+	strikes = strike_prices;
+	volatilities = vols;
+	forward_rates.resize(n_options);
+	expiries.resize(n_options);
+	discount_factors.resize(n_options);
+	Optionlet_Batch::forward_curve(rates.data(), time_of_rates.data(), rates.size(), continuous, freq, forward_rates.data(), expiries.data(), discount_factors.data());
+
+	pillar_prices.resize(rates.size());
+	for (std::size_t i = 0; i < rates.size(); i++)
+	{
+		pillar_prices[i] = zcb_price(rates[i], time_of_rates[i]);
+	}
+
+	caplet_prices.resize(n_options);
+	floorlet_prices.resize(n_options);
+	digital_caplet_prices.resize(n_options);
+	digital_floorlet_prices.resize(n_options);
+	forward_dirty.assign(n_options, 0);
+	price_dirty.assign(n_options, 0);
+	dirty_optionlets.reserve(n_options);
+	old_prices.reserve(4 * n_options);
+
+	Optionlet_Batch::optionlet_values(strikes.data(), volatilities.data(), forward_rates.data(), expiries.data(), discount_factors.data(),
+		caplet_prices.data(), floorlet_prices.data(), digital_caplet_prices.data(), digital_floorlet_prices.data(), n_options);
+	optionlets_repriced = n_options;
+	sum_totals();
+}
+
+
+/**
+* Function to move the zero rate of one pillar. The optionlets ending at the pillar (discount factor
+* and forward) and starting at it (forward) are marked dirty, nothing else is touched.
+* @param pillar const size_t reference, denotes the index of the pillar (0 to N).
+* @param rate const double reference, denotes the new zero rate.
+*/
+void Cap_Floor_Book::set_rate(const std::size_t& pillar, const double& rate)
+{
+	if (pillar >= rates.size())
+	{
+		throw 3;
+	}
+	else if (rate <= 0)
+	{
+		throw 2; // All rates must be positive.
+	}
+
+	rates[pillar] = rate;
+	pillar_prices[pillar] = zcb_price(rate, time_of_rates[pillar]);
+
+	if (pillar > 0)
+	{
+		forward_dirty[pillar - 1] = 1;
+		mark_price_dirty(pillar - 1);
+	}
+	if (pillar < strikes.size())
+	{
+		forward_dirty[pillar] = 1;
+		mark_price_dirty(pillar);
+	}
+}
+
+
+/**
+* Function to change the volatility of one optionlet, only that optionlet is marked dirty.
+* @param optionlet const size_t reference, denotes the index of the optionlet.
+* @param vol const double reference, denotes the new volatility.
+*/
+void Cap_Floor_Book::set_volatility(const std::size_t& optionlet, const double& vol)
+{
+	if (optionlet >= strikes.size())
+	{
+		throw 3;
+	}
+	else if (vol < 0.)
+	{
+		throw 2;
+	}
+	volatilities[optionlet] = vol;
+	mark_price_dirty(optionlet);
+}
+
+
+/**
+* Function to change the strike of one optionlet, only that optionlet is marked dirty.
+* @param optionlet const size_t reference, denotes the index of the optionlet.
+* @param strike const double reference, denotes the new strike.
+*/
+void Cap_Floor_Book::set_strike(const std::size_t& optionlet, const double& strike)
+{
+	if (optionlet >= strikes.size())
+	{
+		throw 3;
+	}
+	else if (strike < 0.)
+	{
+		throw 2;
+	}
+	strikes[optionlet] = strike;
+	mark_price_dirty(optionlet);
+}
+
+
+/**
+* Function to reprice the dirty optionlets and move the totals by the change in their prices.
+* Adjacent dirty optionlets are valued together by the batch kernel. The totals are re-summed
+* exactly once as many incremental updates as there are optionlets have been applied, which
+* bounds the rounding drift at an amortised O(1) cost per update.
+* Returns the number of optionlets repriced.
+*/
+std::size_t Cap_Floor_Book::reprice()
+{
+	std::size_t n_dirty = dirty_optionlets.size();
+	if (n_dirty == 0)
+	{
+		return 0;
+	}
+
+	std::sort(dirty_optionlets.begin(), dirty_optionlets.end());
+	old_prices.clear();
+	for (auto &i : dirty_optionlets)
+	{
+		if (forward_dirty[i])
+		{
+			update_period(i);
+			forward_dirty[i] = 0;
+		}
+		old_prices.push_back(caplet_prices[i]);
+		old_prices.push_back(floorlet_prices[i]);
+		old_prices.push_back(digital_caplet_prices[i]);
+		old_prices.push_back(digital_floorlet_prices[i]);
+	}
+
+	// Value each run of consecutive dirty optionlets in one kernel call
+	std::size_t run_start = 0;
+	for (std::size_t j = 1; j <= n_dirty; j++)
+	{
+		if (j < n_dirty && dirty_optionlets[j] == dirty_optionlets[j - 1] + 1)
+		{
+			continue;
+		}
+		std::size_t i = dirty_optionlets[run_start];
+		Optionlet_Batch::optionlet_values(&strikes[i], &volatilities[i], &forward_rates[i], &expiries[i], &discount_factors[i],
+			&caplet_prices[i], &floorlet_prices[i], &digital_caplet_prices[i], &digital_floorlet_prices[i], j - run_start);
+		run_start = j;
+	}
+
+	for (std::size_t j = 0; j < n_dirty; j++)
+	{
+		std::size_t i = dirty_optionlets[j];
+		cap_total += caplet_prices[i] - old_prices[4 * j];
+		floor_total += floorlet_prices[i] - old_prices[4 * j + 1];
+		digital_cap_total += digital_caplet_prices[i] - old_prices[4 * j + 2];
+		digital_floor_total += digital_floorlet_prices[i] - old_prices[4 * j + 3];
+		price_dirty[i] = 0;
+	}
+	dirty_optionlets.clear();
+
+	optionlets_repriced += n_dirty;
+	updates_since_sum += n_dirty;
+	if (updates_since_sum >= strikes.size())
+	{
+		sum_totals();
+	}
+	return n_dirty;
+}
+
+
+/**
+* Function to add an optionlet to the dirty list, once.
+* @param optionlet const size_t reference, denotes the index of the optionlet.
+*/
+void Cap_Floor_Book::mark_price_dirty(const std::size_t& optionlet)
+{
+	if (!price_dirty[optionlet])
+	{
+		price_dirty[optionlet] = 1;
+		dirty_optionlets.push_back(optionlet);
+	}
+}
+
+
+/**
+* Function to recompute the forward rate and payment discount factor of one optionlet from the
+* ZCB prices of its two pillars (same formulae as Optionlet_Batch::forward_curve).
+* @param optionlet const size_t reference, denotes the index of the optionlet.
+*/
+void Cap_Floor_Book::update_period(const std::size_t& optionlet)
+{
+	double price_1 = pillar_prices[optionlet];
+	double price_2 = pillar_prices[optionlet + 1];
+	unsigned int time_1 = time_of_rates[optionlet];
+	unsigned int time_2 = time_of_rates[optionlet + 1];
+
+	if (continuous_compounding)
+	{
+		forward_rates[optionlet] = Continuous_Compounding::forward_rate(price_1, price_2, time_1, time_2, compounding_frequency);
+	}
+	else {
+		forward_rates[optionlet] = Discrete_Compounding::forward_rate(price_1, price_2, time_1, time_2, compounding_frequency);
+	}
+	discount_factors[optionlet] = price_2;
+}
+
+
+/**
+* Function to sum the optionlet prices of every product exactly.
+*/
+void Cap_Floor_Book::sum_totals()
+{
+	cap_total = 0;
+	floor_total = 0;
+	digital_cap_total = 0;
+	digital_floor_total = 0;
+	for (std::size_t i = 0; i < strikes.size(); i++)
+	{
+		cap_total += caplet_prices[i];
+		floor_total += floorlet_prices[i];
+		digital_cap_total += digital_caplet_prices[i];
+		digital_floor_total += digital_floorlet_prices[i];
+	}
+	updates_since_sum = 0;
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+
+
+/**
+* Project:    Project 1
+* Filename:   Cap_Floor_Book.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Mutable cap/floor book repricing only the optionlets affected by a rate or volatility update.
+*
+* Optionlet i is written on the period between pillars i and i+1, so zero rate i only feeds
+* optionlets i-1 (through the discount factor and forward at its payment date) and i (through
+* the forward from its fixing date), while volatility and strike i only feed optionlet i.
+*/
+class Cap_Floor_Book
+{
+private:
+	// Attributes: curve pillars
+	std::vector<double> rates;
+	std::vector<unsigned int> time_of_rates;
+	std::vector<double> pillar_prices; // ZCB price at each pillar
+	bool continuous_compounding{ false };
+	int compounding_frequency{ 4 };
+
+	// Attributes: optionlets (one contiguous array per quantity)
+	std::vector<double> strikes;
+	std::vector<double> volatilities;
+	std::vector<double> forward_rates;
+	std::vector<double> expiries; // t_1 of each optionlet (days)
+	std::vector<double> discount_factors; // ZCB price at t_2 of each optionlet
+	std::vector<double> caplet_prices;
+	std::vector<double> floorlet_prices;
+	std::vector<double> digital_caplet_prices;
+	std::vector<double> digital_floorlet_prices;
+
+	// Attributes: dependency tracking
+	std::vector<unsigned char> forward_dirty; // forward and discount factor must be recomputed
+	std::vector<unsigned char> price_dirty; // optionlet must be repriced
+	std::vector<std::size_t> dirty_optionlets; // each dirty optionlet listed once
+	std::vector<double> old_prices; // caplet, floorlet, digital caplet, digital floorlet of each dirty optionlet
+	double cap_total{ 0 };
+	double floor_total{ 0 };
+	double digital_cap_total{ 0 };
+	double digital_floor_total{ 0 };
+	std::size_t updates_since_sum{ 0 }; // incremental total updates since the totals were last summed exactly
+	std::size_t optionlets_repriced{ 0 };
+
+	// Methods
+	void mark_price_dirty(const std::size_t& optionlet);
+	void update_period(const std::size_t& optionlet);
+	void sum_totals();
+
+
+public:
+	// Constructors & Destructor
+	Cap_Floor_Book(const std::vector<double>& strike_prices, const std::vector<double>& vols, const std::vector<double>& zero_rates, const std::vector<unsigned int>& times, const bool& continuous, const int& freq = 4);
+	~Cap_Floor_Book() {};
+
+	// Update Methods (mark the dependent optionlets dirty, reprice() values them)
+	void set_rate(const std::size_t& pillar, const double& rate);
+	void set_volatility(const std::size_t& optionlet, const double& vol);
+	void set_strike(const std::size_t& optionlet, const double& strike);
+	std::size_t reprice();
+
+	// Getter Methods
+	std::size_t size() { return strikes.size(); };
+	std::size_t get_dirty_count() { return dirty_optionlets.size(); };
+	std::size_t get_optionlets_repriced() { return optionlets_repriced; }; // since construction, including the initial pricing
+	const std::vector<double>& get_rates() { return rates; };
+	const std::vector<double>& get_volatilities() { return volatilities; };
+	const std::vector<double>& get_forward_rates() { return forward_rates; };
+	const std::vector<double>& get_cap_prices() { return caplet_prices; };
+	const std::vector<double>& get_floor_prices() { return floorlet_prices; };
+	const std::vector<double>& get_digital_cap_prices() { return digital_caplet_prices; };
+	const std::vector<double>& get_digital_floor_prices() { return digital_floorlet_prices; };
+	double get_cap_price() { return cap_total; };
+	double get_floor_price() { return floor_total; };
+	double get_collar_price() { return cap_total - floor_total; };
+	double get_digital_cap_price() { return digital_cap_total; };
+	double get_digital_floor_price() { return digital_floor_total; };
+};
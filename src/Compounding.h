@@ -0,0 +1,125 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+
+
+/**
+* Project:    Project 1
+* Filename:   Compounding.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Compile-time compounding policies and the generic forward rate kernels built on them.
+*
+* A policy turns the ZCB prices P_1, P_2 at t_1 < t_2 (days) into the forward rate of the period (see
+* Term_Structure.cpp for the formulae). Everything is a template over the numeric type T, with exp, log and
+* pow called unqualified, so one definition serves double, float and any type supplying those functions
+* through argument dependent lookup (e.g. the forward mode Dual of Dual_Number.h). The choice between the
+* policies is made once, outside the loops, and each instantiation only computes its own convention.
+*/
+
+
+struct Continuous_Compounding
+{
+	/**
+	* Function to return the continuously compounded forward rate log(P_1/P_2) / (t_2 - t_1).
+	* @param price_1 const T reference, denotes the ZCB price at t_1.
+	* @param price_2 const T reference, denotes the ZCB price at t_2.
+	* @param t_1 const double reference, denotes the start of the period (days).
+	* @param t_2 const double reference, denotes the end of the period (days).
+	* @param freq const int reference, unused (kept so both policies share one signature).
+	*/
+	template<class T> static T forward_rate(const T& price_1, const T& price_2, const double& t_1, const double& t_2, [[maybe_unused]] const int& freq)
+	{
+		using std::log;
+		return log(price_1 / price_2) / T((t_2 - t_1) / 365.);
+	}
+
+	/**
+	* Function to return the forward rate from log(P_1/P_2), for callers already holding the log ratio.
+	* Parameters as for forward_rate.
+	*/
+	template<class T> static T forward_from_log_ratio(const T& log_ratio, const double& t_1, const double& t_2, [[maybe_unused]] const int& freq)
+	{
+		return log_ratio / T((t_2 - t_1) / 365.);
+	}
+};
+
+
+struct Discrete_Compounding
+{
+	/**
+	* Function to return the forward rate compounded freq times a year, freq ((P_1/P_2)^(1/n) - 1) with n the
+	* number of whole compounding periods in [t_1, t_2]. Parameters as for Continuous_Compounding::forward_rate.
+	*/
+	template<class T> static T forward_rate(const T& price_1, const T& price_2, const double& t_1, const double& t_2, const int& freq)
+	{
+		using std::pow;
+		int n_compound_increments = int(((t_2 - t_1) * freq) / 365.);
+		return (pow(price_1 / price_2, 1. / n_compound_increments) - T(1)) * T(freq);
+	}
+
+	template<class T> static T forward_from_log_ratio(const T& log_ratio, const double& t_1, const double& t_2, const int& freq)
+	{
+		using std::exp;
+		int n_compound_increments = int(((t_2 - t_1) * freq) / 365.);
+		return (exp(log_ratio / T(n_compound_increments)) - T(1)) * T(freq);
+	}
+};
+
+
+/**
+* Function to return the ZCB price exp(-r t) of a continuously compounded zero rate.
+* @param rate const T reference, denotes the zero rate.
+* @param time const double reference, denotes the maturity (days).
+*/
+template<class T> inline T zcb_price(const T& rate, const double& time)
+{
+	using std::exp;
+	return exp(-1 * rate * T(time / double(365)));
+}
+
+
+/**
+* Kernel to compute, for each of the n_rates-1 periods of a set of zero rates, the forward rate under the
+* Compounding policy, the start of the period and the ZCB price at its end, with no checks. Each pillar's
+* ZCB price is computed once and shared by the two periods it bounds.
+* @param rates const T pointer, denotes the zero rates at each pillar.
+* @param time_of_rates const unsigned int pointer, denotes the time (days) of each pillar.
+* @param n_rates const size_t reference, denotes the number of pillars.
+* @param freq const int reference, denotes the compounding frequency.
+* @param forward T pointer, denotes the output array of forward rates (length n_rates-1).
+* @param t_1 T pointer, denotes the output array of period start times (length n_rates-1).
+* @param discount T pointer, denotes the output array of ZCB prices at period ends (length n_rates-1).
+*/
+template<class Compounding, class T> inline void compounded_periods(const T* rates, const unsigned int* time_of_rates, const std::size_t& n_rates, const int& freq, T* forward, T* t_1, T* discount)
+{
+	if (n_rates == 0)
+	{
+		return;
+	}
+
+	T price_1 = zcb_price(rates[0], time_of_rates[0]);
+	for (std::size_t i = 0; i + 1 < n_rates; i++)
+	{
+		T price_2 = zcb_price(rates[i + 1], time_of_rates[i + 1]);
+		forward[i] = Compounding::forward_rate(price_1, price_2, time_of_rates[i], time_of_rates[i + 1], freq);
+		t_1[i] = T(time_of_rates[i]);
+		discount[i] = price_2;
+		price_1 = price_2;
+	}
+}
+
+
+/**
+* Kernel to compute only the forward rate of each of the n_rates-1 periods of a set of zero rates, with no
+* checks. log(P_1/P_2) = r_2 t_2 - r_1 t_1 is formed from the rates directly, so no ZCB price is computed.
+* Parameters as for compounded_periods.
+*/
+template<class Compounding, class T> inline void compounded_forwards(const T* rates, const unsigned int* time_of_rates, const std::size_t& n_rates, const int& freq, T* forward)
+{
+	for (std::size_t i = 0; i + 1 < n_rates; i++)
+	{
+		T log_ratio = rates[i + 1] * T(time_of_rates[i + 1] / double(365)) - rates[i] * T(time_of_rates[i] / double(365));
+		forward[i] = Compounding::forward_from_log_ratio(log_ratio, time_of_rates[i], time_of_rates[i + 1], freq);
+	}
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include <cstdint>
+#include <cmath>
+
+
+/**
+* Project:    Project 1
+* Filename:   Counter_Rng.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Counter-based random numbers (Philox4x32-10) for reproducible parallel Monte Carlo.
+*
+* Every draw is a pure function of (seed, path, step, index), so a path sees the same numbers
+* whichever thread simulates it and in whatever order: results do not depend on the thread count.
+* Reference: Salmon, Moraes, Dror & Shaw (2011), "Parallel random numbers: as easy as 1, 2, 3".
+*/
+class Counter_Rng
+{
+public:
+	/**
+	* Function to encrypt a 128 bit counter under a 64 bit key with ten Philox rounds.
+	* @param counter const uint32 array reference, denotes the counter.
+	* @param key const uint64 reference, denotes the key (e.g. the seed of the simulation).
+	* @param out uint32 array reference, filled with four independent 32 bit random words.
+	*/
+	static inline void philox(const std::uint32_t(&counter)[4], const std::uint64_t& key, std::uint32_t(&out)[4])
+	{
+		std::uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+		std::uint32_t k0 = std::uint32_t(key), k1 = std::uint32_t(key >> 32);
+		for (int round = 0; round < 10; round++)
+		{
+			std::uint64_t product_0 = std::uint64_t(0xD2511F53u) * c0;
+			std::uint64_t product_1 = std::uint64_t(0xCD9E8D57u) * c2;
+			std::uint32_t hi_0 = std::uint32_t(product_0 >> 32), lo_0 = std::uint32_t(product_0);
+			std::uint32_t hi_1 = std::uint32_t(product_1 >> 32), lo_1 = std::uint32_t(product_1);
+			c0 = hi_1 ^ c1 ^ k0;
+			c1 = lo_1;
+			c2 = hi_0 ^ c3 ^ k1;
+			c3 = lo_0;
+			k0 += 0x9E3779B9u;
+			k1 += 0xBB67AE85u;
+		}
+		out[0] = c0;
+		out[1] = c1;
+		out[2] = c2;
+		out[3] = c3;
+	}
+
+	/**
+	* Function to draw two independent standard normals (Box-Muller on two 53 bit uniforms in (0, 1)).
+	* @param seed const uint64 reference, denotes the seed of the simulation.
+	* @param path const uint64 reference, denotes the path.
+	* @param step const uint32 reference, denotes the time step.
+	* @param index const uint32 reference, denotes the pair of draws within the step.
+	* @param z_1 double reference, denotes the first normal.
+	* @param z_2 double reference, denotes the second normal.
+	*/
+	static inline void normal_pair(const std::uint64_t& seed, const std::uint64_t& path, const std::uint32_t& step, const std::uint32_t& index, double& z_1, double& z_2)
+	{
+		const std::uint32_t counter[4] = { std::uint32_t(path), std::uint32_t(path >> 32), step, index };
+		std::uint32_t words[4];
+		philox(counter, seed, words);
+
+		const double scale = 1. / 9007199254740992.; // 2^-53
+		double u_1 = (double((std::uint64_t(words[0] >> 11) << 32) | words[1]) + 0.5) * scale;
+		double u_2 = (double((std::uint64_t(words[2] >> 11) << 32) | words[3]) + 0.5) * scale;
+		double radius = sqrt(-2. * log(u_1));
+		double angle = 6.283185307179586476925 * u_2;
+		z_1 = radius * cos(angle);
+		z_2 = radius * sin(angle);
+	}
+};
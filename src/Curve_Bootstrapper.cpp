@@ -0,0 +1,307 @@
+#include "Curve_Bootstrapper.h"
+#include "Black_Simd.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+/**
+* Project:    Project 1
+* Filename:   Curve_Bootstrapper.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Sequential bootstrapper solving a zero curve from the prices of a strip of coupon-paying bonds.
+*/
+
+
+/**
+* Constructor for a bootstrapper.
+* @param tol const double reference, denotes the fractional error allowed on the price of each bond.
+*/
+Curve_Bootstrapper::Curve_Bootstrapper(const double& tol)
+{
+	tolerance = tol;
+}
+
+
+/**
+* Function to bootstrap the zero curve from bonds stored back to back in contiguous arrays (see Bond_Book.h).
+* A bond whose pillar cannot be solved (invalid input, a maturity already used by an earlier bond, or a price
+* outside the attainable range) is reported in its result and skipped, the later pillars are solved without it.
+* @param amounts const double pointer, denotes the cashflows of every bond (principal included).
+* @param times const double pointer, denotes the time (days) of every cashflow.
+* @param offsets const size_t pointer, denotes where the cashflows of each bond start (n_bonds + 1 entries).
+* @param n_bonds const size_t reference, denotes the number of bonds.
+* @param prices const double pointer, denotes the price of each bond.
+* Returns the number of pillars of the curve.
+*/
+std::size_t Curve_Bootstrapper::bootstrap(const double* amounts, const double* times, const std::size_t* offsets, const std::size_t& n_bonds, const double* prices)
+{
+	zero_rates.clear();
+	pillar_times.clear();
+	pillar_logs.clear();
+	results.resize(n_bonds);
+	maturities.resize(n_bonds);
+	order.resize(n_bonds);
+
+	for (std::size_t b = 0; b < n_bonds; b++)
+	{
+		double maturity = 0;
+		for (std::size_t c = offsets[b]; c < offsets[b + 1]; c++)
+		{
+			maturity = std::max(maturity, times[c]);
+		}
+		maturities[b] = maturity;
+		order[b] = b;
+	}
+	std::sort(order.begin(), order.end(), [&](const std::size_t& i, const std::size_t& j) { return maturities[i] < maturities[j] || (maturities[i] == maturities[j] && i < j); });
+
+	for (auto &b : order)
+	{
+		double maturity = maturities[b];
+		bool usable = maturity > 0 && maturity == floor(maturity) && maturity <= std::numeric_limits<unsigned int>::max()
+			&& (pillar_times.empty() || maturity > pillar_times.back()) && prices[b] > 0 && std::isfinite(prices[b]);
+		if (!usable)
+		{
+			results[b] = Yield_Result{ std::numeric_limits<double>::quiet_NaN(), 0, Yield_Invalid_Input };
+			continue;
+		}
+
+		results[b] = solve_pillar(amounts + offsets[b], times + offsets[b], offsets[b + 1] - offsets[b], maturity, prices[b]);
+		if (results[b].status == Yield_Converged)
+		{
+			zero_rates.push_back(results[b].yield);
+			pillar_times.push_back((unsigned int)(maturity));
+			pillar_logs.push_back(results[b].yield * maturity / 365.);
+		}
+	}
+	return zero_rates.size();
+}
+
+
+/**
+* Function to bootstrap the zero curve from the bonds of a flat cashflow table.
+* @param book Bond_Book reference, denotes the bonds.
+* @param prices const vector double reference, denotes the price of each bond.
+* Returns the number of pillars of the curve.
+*/
+std::size_t Curve_Bootstrapper::bootstrap(Bond_Book& book, const std::vector<double>& prices)
+{
+	if (prices.size() != book.size())
+	{
+		throw 3; // Check each bond has a corresponding price.
+	}
+	return bootstrap(book.get_amounts().data(), book.get_times().data(), book.get_offsets().data(), book.size(), prices.data());
+}
+
+
+/**
+* Function to bootstrap the zero curve from a strip of bonds. The cashflows are first copied into a flat
+* cashflow table, for repeated rebuilds keep a Bond_Book and use the overload taking it.
+* @param bonds vector Bond reference, denotes the bonds.
+* @param prices const vector double reference, denotes the price of each bond.
+* Returns the number of pillars of the curve.
+*/
+std::size_t Curve_Bootstrapper::bootstrap(std::vector<Bond>& bonds, const std::vector<double>& prices)
+{
+	Bond_Book book;
+	for (auto &b : bonds)
+	{
+		book.add_bond(b);
+	}
+	return bootstrap(book, prices);
+}
+
+
+/**
+* Function to return the bootstrapped curve, e.g. to price caps and floors off it.
+* @param freq const int reference, denotes the compounding frequency of the curve.
+*/
+Discount_Curve Curve_Bootstrapper::get_curve(const int& freq)
+{
+	return Discount_Curve(zero_rates, pillar_times, freq);
+}
+
+
+/**
+* Function to solve the zero rate r at the maturity of one bond, the earlier pillars being known. With the
+* interpolation of Discount_Curve, -log(P(t)) of each cashflow is either known (up to the last pillar) or
+* shift + slope r (after it), so the known part of the price is summed once (one vectorised exp pass) and Newton steps with the
+* analytic derivative -sum c slope exp(-shift - slope r) only revisit the cashflows after the last pillar.
+* The price is a decreasing convex function of r: after the first step the iterates approach the root from
+* below, steps leaving the bracket are replaced by bisection. The search is restricted to 0 < r < max_yield,
+* as Discount_Curve only takes positive rates, and a price needing r <= 0 is reported as Yield_Below_Minimum.
+* @param amounts const double pointer, denotes the cashflows of the bond.
+* @param times const double pointer, denotes the time (days) of each cashflow.
+* @param n_cashflows const size_t reference, denotes the number of cashflows.
+* @param maturity const double reference, denotes the time (days) of the new pillar.
+* @param price const double reference, denotes the price of the bond.
+*/
+Yield_Result Curve_Bootstrapper::solve_pillar(const double* amounts, const double* times, const std::size_t& n_cashflows, const double& maturity, const double& price)
+{
+	Yield_Result result{ std::numeric_limits<double>::quiet_NaN(), 0, Yield_Invalid_Input };
+
+	std::size_t n_pillars = pillar_times.size();
+	double last_time = n_pillars ? pillar_times.back() : 0.;
+	double last_log = n_pillars ? pillar_logs.back() : 0.;
+	double known = 0;
+	known_logs.clear();
+	known_amounts.clear();
+	dependent_shifts.clear();
+	slopes.clear();
+	dependent_amounts.clear();
+
+	std::size_t segment = 1; // pillar ending the period of the previous cashflow, walked forward as cashflows are usually in date order
+	for (std::size_t c = 0; c < n_cashflows; c++)
+	{
+		double amount = amounts[c];
+		double t = times[c];
+		if (!(amount >= 0) || !std::isfinite(amount) || !(t >= 0) || !std::isfinite(t))
+		{
+			return result;
+		}
+		if (t <= 0)
+		{
+			known += amount;
+		}
+		else if (n_pillars > 0 && t <= last_time)
+		{
+			if (t <= pillar_times[0])
+			{
+				known_logs.push_back(-1 * zero_rates[0] * (t / 365.)); // flat before the first pillar
+			}
+			else {
+				if (segment >= n_pillars || t <= pillar_times[segment - 1])
+				{
+					segment = std::lower_bound(pillar_times.begin(), pillar_times.end(), t, [](const unsigned int& p, const double& d) { return p < d; }) - pillar_times.begin();
+				}
+				while (pillar_times[segment] < t)
+				{
+					segment++;
+				}
+				std::size_t lower = segment - 1;
+				double weight = (t - pillar_times[lower]) / double(pillar_times[segment] - pillar_times[lower]);
+				known_logs.push_back(-1 * (pillar_logs[lower] + weight * (pillar_logs[segment] - pillar_logs[lower])));
+			}
+			known_amounts.push_back(amount);
+		}
+		else {
+			if (n_pillars == 0 || t >= maturity)
+			{
+				dependent_shifts.push_back(0.);
+				slopes.push_back(t / 365.); // flat before the first pillar (or after the last)
+			}
+			else {
+				double weight = (t - last_time) / (maturity - last_time);
+				dependent_shifts.push_back((1 - weight) * last_log);
+				slopes.push_back(weight * maturity / 365.);
+			}
+			dependent_amounts.push_back(amount);
+		}
+	}
+
+	// Discount the cashflows fixed by the earlier pillars in one vectorised pass
+	std::size_t n_known = known_logs.size();
+	Black_Simd::exponentials(known_logs.data(), known_logs.data(), n_known);
+	for (std::size_t i = 0; i < n_known; i++)
+	{
+		known += known_amounts[i] * known_logs[i];
+	}
+
+	std::size_t n_dependent = dependent_amounts.size();
+	double target = price - known;
+	double base = 0; // value of the dependent cashflows at r = 0
+	double weighted_slope = 0;
+	for (std::size_t i = 0; i < n_dependent; i++)
+	{
+		double pv = dependent_amounts[i] * exp(-dependent_shifts[i]);
+		base += pv;
+		weighted_slope += pv * slopes[i];
+	}
+	if (n_dependent == 0 || !(base > 0))
+	{
+		return result; // nothing to solve for
+	}
+	if (!(target > 0))
+	{
+		result.status = Yield_Above_Maximum; // the earlier pillars alone already exceed the price
+		return result;
+	}
+
+	// First order guess: target = base exp(-r average slope)
+	double r = log(base / target) / (weighted_slope / base);
+	if (!(r > 0 && r < Yield_Solver::max_yield))
+	{
+		r = n_pillars ? zero_rates.back() : 0.5 * Yield_Solver::max_yield;
+	}
+
+	double lower = 0; // exclusive, the pillar must be usable by Discount_Curve
+	double upper = Yield_Solver::max_yield;
+	bool lower_checked = false;
+	bool upper_checked = false;
+	while (result.iterations < Yield_Solver::max_iterations)
+	{
+		double value = 0;
+		double d_value = 0;
+		for (std::size_t i = 0; i < n_dependent; i++)
+		{
+			double pv = dependent_amounts[i] * exp(-dependent_shifts[i] - slopes[i] * r);
+			value += pv;
+			d_value -= slopes[i] * pv;
+		}
+		double error = value - target;
+		result.iterations++;
+
+		if (fabs(error) <= tolerance * price)
+		{
+			result.yield = r;
+			result.status = Yield_Converged;
+			return result;
+		}
+		if (error > 0)
+		{
+			lower = r;
+			lower_checked = true;
+		}
+		else {
+			upper = r;
+			upper_checked = true;
+		}
+
+		double r_new = d_value < 0 ? r - error / d_value : lower - 1;
+		if (!(r_new > lower && r_new < upper))
+		{
+			r_new = 0.5 * (lower + upper);
+		}
+		if (lower_checked && upper_checked && fabs(r_new - r) <= std::numeric_limits<double>::epsilon() * (1 + fabs(r)))
+		{
+			result.yield = r_new;
+			result.status = Yield_Converged; // bracket collapsed onto the root
+			return result;
+		}
+		r = r_new;
+	}
+
+	// Classify failures at the ends of the search interval (see Yield_Solver::solve), the lower end being r = 0
+	result.status = Yield_Max_Iterations;
+	result.yield = r;
+	if (!lower_checked || !upper_checked)
+	{
+		double value_max = 0;
+		for (std::size_t i = 0; i < n_dependent; i++)
+		{
+			value_max += dependent_amounts[i] * exp(-dependent_shifts[i] - slopes[i] * Yield_Solver::max_yield);
+		}
+		if (!lower_checked && base <= target) // base is the value at r = 0
+		{
+			result.status = Yield_Below_Minimum;
+			result.yield = std::numeric_limits<double>::quiet_NaN();
+		}
+		else if (!upper_checked && value_max > target)
+		{
+			result.status = Yield_Above_Maximum;
+			result.yield = std::numeric_limits<double>::quiet_NaN();
+		}
+	}
+	return result;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include "Bond.h"
+#include "Bond_Book.h"
+#include "Discount_Curve.h"
+#include "Yield_Solver.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Curve_Bootstrapper.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Sequential bootstrapper solving a zero curve from the prices of a strip of coupon-paying bonds.
+*
+* Each bond adds a pillar at its maturity. Bonds are taken in order of maturity and the zero rate of each
+* pillar is solved with the earlier pillars held fixed, using the interpolation of Discount_Curve, so the
+* curve returned by get_curve reprices every bond. Zero rates are solved in (0, Yield_Solver::max_yield), so every
+* converged pillar can be built by Discount_Curve, a bond needing a non-positive rate is reported as
+* Yield_Below_Minimum and skipped. Buffers are kept between calls, so rebuilding the curve
+* every tick from the same set of bonds makes no allocations.
+*/
+class Curve_Bootstrapper
+{
+private:
+	// Attributes: output curve (only pillars whose solve converged)
+	std::vector<double> zero_rates;
+	std::vector<unsigned int> pillar_times;
+	std::vector<double> pillar_logs; // -log(P) = r t at each pillar
+
+	// Attributes: per bond
+	std::vector<std::size_t> order; // bond indices sorted by maturity
+	std::vector<double> maturities;
+	std::vector<Yield_Result> results; // zero rate solved at the maturity of each bond (yield field)
+	std::vector<double> known_logs; // log(P) of each cashflow fixed by the earlier pillars
+	std::vector<double> known_amounts;
+	std::vector<double> dependent_shifts; // -log(P) = shift + slope r of each cashflow of the bond being solved
+	std::vector<double> slopes;
+	std::vector<double> dependent_amounts;
+	double tolerance;
+
+	// Methods
+	Yield_Result solve_pillar(const double* amounts, const double* times, const std::size_t& n_cashflows, const double& maturity, const double& price);
+
+
+public:
+	// Constructor & Destructor
+	Curve_Bootstrapper(const double& tol = 1e-12);
+	~Curve_Bootstrapper() {};
+
+	// Methods
+	std::size_t bootstrap(const double* amounts, const double* times, const std::size_t* offsets, const std::size_t& n_bonds, const double* prices);
+	std::size_t bootstrap(Bond_Book& book, const std::vector<double>& prices);
+	std::size_t bootstrap(std::vector<Bond>& bonds, const std::vector<double>& prices);
+	Discount_Curve get_curve(const int& freq = 4);
+
+	// Getter Methods
+	std::size_t get_pillar_count() { return zero_rates.size(); };
+	const std::vector<double>& get_zero_rates() { return zero_rates; };
+	const std::vector<unsigned int>& get_pillar_times() { return pillar_times; };
+	const std::vector<Yield_Result>& get_results() { return results; }; // one per bond, in the order given
+};
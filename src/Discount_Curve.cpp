@@ -0,0 +1,156 @@
+#include "Discount_Curve.h"
+#include "Compounding.h"
+#include <algorithm>
+#include <cmath>
+
+
+/**
+* Project:    Project 1
+* Filename:   Discount_Curve.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Multi-point zero curve built once and shared by reference by caps, floors and bonds.
+*/
+
+
+/**
+* Constructor for a zero curve built from the full set of zero rates. The ZCB price at each pillar
+* is computed once (one exp per pillar), and the continuous and discrete forward rates of every
+* period between consecutive pillars are computed once from those prices (see Term_Structure.cpp
+* for the formulae), so objects pricing off the curve never recompute them.
+* @param rates const vector double reference, denotes the zero rate at each pillar.
+* @param time_of_rates const vector usigned int reference, denotes the times at which each of the rates occurs.
+* @param freq const int reference, denotes the compounding frequency.
+* @param resource memory_resource pointer, denotes where the arrays of the curve are allocated.
+*/
+Discount_Curve::Discount_Curve(const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const int& freq, std::pmr::memory_resource* resource)
+	: zero_rates(resource), pillar_times(resource), discount_factors(resource), continuous_forwards(resource), discrete_forwards(resource), period_starts(resource), period_discounts(resource)
+{
+	if (rates.empty() || rates.size() != time_of_rates.size())
+	{
+		throw 3; // Each rate needs a corresponding time.
+	}
+	if (freq <= 0)
+	{
+		throw 2;
+	}
+	for (std::size_t i = 0; i < rates.size(); i++)
+	{
+		if (rates[i] <= 0 || time_of_rates[i] <= 0)
+		{
+			throw 2; // All rates, times, and compounding frequency must be positive.
+		}
+		if (i > 0 && time_of_rates[i] <= time_of_rates[i - 1])
+		{
+			throw 1; // Each rate should occur chronologically after the previous one.
+		}
+	}
+
+	compounding_frequency = freq;
+	zero_rates.assign(rates.begin(), rates.end());
+	pillar_times.assign(time_of_rates.begin(), time_of_rates.end());
+
+	std::size_t n_pillars = rates.size();
+	discount_factors.resize(n_pillars);
+	for (std::size_t i = 0; i < n_pillars; i++)
+	{
+		discount_factors[i] = zcb_price(rates[i], time_of_rates[i]);
+	}
+
+	std::size_t n_periods = n_pillars - 1;
+	continuous_forwards.resize(n_periods);
+	discrete_forwards.resize(n_periods);
+	period_starts.resize(n_periods);
+	period_discounts.resize(n_periods);
+	for (std::size_t i = 0; i < n_periods; i++)
+	{
+		continuous_forwards[i] = Continuous_Compounding::forward_rate(discount_factors[i], discount_factors[i + 1], time_of_rates[i], time_of_rates[i + 1], freq);
+		discrete_forwards[i] = Discrete_Compounding::forward_rate(discount_factors[i], discount_factors[i + 1], time_of_rates[i], time_of_rates[i + 1], freq);
+		period_starts[i] = time_of_rates[i];
+		period_discounts[i] = discount_factors[i + 1];
+	}
+}
+
+
+/**
+* Default constructor that sets up an empty curve.
+* Compounding frequency is initialised to 4 by assumption of the project.
+*/
+Discount_Curve::Discount_Curve()
+{
+	compounding_frequency = 4;
+}
+
+
+/**
+* Function to return the ZCB price at an arbitrary day. Between pillars -log(P) is interpolated
+* linearly in time (flat continuous forward over each period). Before the first pillar the first
+* zero rate is used, after the last pillar the last zero rate is used.
+* @param day const double reference, denotes the time (days) of the cashflow.
+*/
+double Discount_Curve::get_discount_factor(const double& day) const
+{
+	if (pillar_times.empty())
+	{
+		throw 3;
+	}
+	if (day <= 0)
+	{
+		return 1.;
+	}
+
+	std::size_t n_pillars = pillar_times.size();
+	if (day <= pillar_times[0])
+	{
+		return exp(-1 * zero_rates[0] * (day / 365.));
+	}
+	if (day >= pillar_times[n_pillars - 1])
+	{
+		return exp(-1 * zero_rates[n_pillars - 1] * (day / 365.));
+	}
+
+	// First pillar strictly after the day, the day lies in the period ending there.
+	std::size_t upper = std::upper_bound(pillar_times.begin(), pillar_times.end(), day, [](const double& d, const unsigned int& t) { return d < t; }) - pillar_times.begin();
+	std::size_t lower = upper - 1;
+	double weight = (day - pillar_times[lower]) / double(pillar_times[upper] - pillar_times[lower]);
+	double log_p_lower = log(discount_factors[lower]);
+	double log_p_upper = log(discount_factors[upper]);
+	return exp(log_p_lower + weight * (log_p_upper - log_p_lower));
+}
+
+
+/**
+* Function to return the (continuously compounded) zero rate at an arbitrary day.
+* @param day const double reference, denotes the time (days).
+*/
+double Discount_Curve::get_zero_rate(const double& day) const
+{
+	if (day <= 0)
+	{
+		return zero_rates.at(0);
+	}
+	return -1 * log(get_discount_factor(day)) / (day / 365.);
+}
+
+
+/**
+* Function to return the forward rate between two arbitrary days (see Term_Structure.cpp for the formulae).
+* @param day_1 const double reference, denotes the start of the period (days).
+* @param day_2 const double reference, denotes the end of the period (days).
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+*/
+double Discount_Curve::get_forward_rate(const double& day_1, const double& day_2, const bool& continuous) const
+{
+	if (day_2 <= day_1)
+	{
+		throw 1; // Second time should occur chronologically after the first, i.e. t_1 < t_2.
+	}
+
+	double price_1 = get_discount_factor(day_1);
+	double price_2 = get_discount_factor(day_2);
+	if (continuous)
+	{
+		return Continuous_Compounding::forward_rate(price_1, price_2, day_1, day_2, compounding_frequency);
+	}
+	return Discrete_Compounding::forward_rate(price_1, price_2, day_1, day_2, compounding_frequency);
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <memory_resource>
+
+
+/**
+* Project:    Project 1
+* Filename:   Discount_Curve.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Multi-point zero curve built once and shared by reference by caps, floors and bonds.
+*
+* The arrays are allocated from the memory resource given on construction (e.g. a Pricing_Workspace), the
+* default heap resource otherwise. A copy allocates from the default resource.
+*/
+class Discount_Curve
+{
+private:
+	// Attributes (one entry per pillar)
+	int compounding_frequency;
+	std::pmr::vector<double> zero_rates;
+	std::pmr::vector<unsigned int> pillar_times; // days
+	std::pmr::vector<double> discount_factors; // ZCB price at each pillar
+
+	// Attributes (one entry per period between consecutive pillars)
+	std::pmr::vector<double> continuous_forwards;
+	std::pmr::vector<double> discrete_forwards;
+	std::pmr::vector<double> period_starts; // t_1 of each period (days)
+	std::pmr::vector<double> period_discounts; // ZCB price at t_2 of each period
+
+
+public:
+	// Constructors & Destructor
+	Discount_Curve(const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const int& freq = 4, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+	Discount_Curve();
+	~Discount_Curve() {};
+
+	// Interpolation at arbitrary day counts (log-linear in the discount factor)
+	double get_discount_factor(const double& day) const;
+	double get_zero_rate(const double& day) const;
+	double get_forward_rate(const double& day_1, const double& day_2, const bool& continuous) const;
+
+	// Getter Methods
+	std::size_t size() const { return pillar_times.size(); };
+	std::size_t period_count() const { return continuous_forwards.size(); };
+	int get_compounding_frequency() const { return compounding_frequency; };
+	double get_zero_rate_at_pillar(const std::size_t& pillar) const { return zero_rates.at(pillar); };
+	unsigned int get_time(const std::size_t& pillar) const { return pillar_times.at(pillar); };
+	double get_pillar_discount_factor(const std::size_t& pillar) const { return discount_factors.at(pillar); };
+	double get_period_forward(const std::size_t& period, const bool& continuous) const { return continuous ? continuous_forwards.at(period) : discrete_forwards.at(period); };
+	const std::pmr::vector<double>& get_zero_rates() const { return zero_rates; };
+	const std::pmr::vector<unsigned int>& get_times() const { return pillar_times; };
+	const std::pmr::vector<double>& get_forward_rates(const bool& continuous) const { return continuous ? continuous_forwards : discrete_forwards; };
+	const std::pmr::vector<double>& get_period_starts() const { return period_starts; };
+	const std::pmr::vector<double>& get_period_discounts() const { return period_discounts; };
+};
@@ -0,0 +1,56 @@
+#pragma once
+#include <cmath>
+
+
+/**
+* Project:    Project 1
+* Filename:   Dual_Number.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Forward mode automatic differentiation number, carrying a value and its derivative along one direction.
+*
+* Instantiating the generic kernels of Compounding.h and Black_Formula.h with Dual gives the derivative of their output with respect
+* to whichever input was seeded with derivative 1, through exactly the code used for double.
+*/
+struct Dual
+{
+	double value;
+	double derivative;
+
+	Dual() : value(0), derivative(0) {};
+	Dual(const double& v, const double& d = 0) : value(v), derivative(d) {};
+};
+
+inline Dual operator+(const Dual& a, const Dual& b) { return Dual(a.value + b.value, a.derivative + b.derivative); };
+inline Dual operator-(const Dual& a, const Dual& b) { return Dual(a.value - b.value, a.derivative - b.derivative); };
+inline Dual operator-(const Dual& a) { return Dual(-a.value, -a.derivative); };
+inline Dual operator*(const Dual& a, const Dual& b) { return Dual(a.value * b.value, a.derivative * b.value + a.value * b.derivative); };
+inline Dual operator/(const Dual& a, const Dual& b) { return Dual(a.value / b.value, (a.derivative * b.value - a.value * b.derivative) / (b.value * b.value)); };
+inline Dual operator*(const double& a, const Dual& b) { return Dual(a * b.value, a * b.derivative); };
+inline Dual operator*(const Dual& a, const double& b) { return Dual(a.value * b, a.derivative * b); };
+inline Dual operator/(const Dual& a, const double& b) { return Dual(a.value / b, a.derivative / b); };
+
+inline Dual exp(const Dual& a)
+{
+	double e = std::exp(a.value);
+	return Dual(e, e * a.derivative);
+};
+
+inline Dual log(const Dual& a) { return Dual(std::log(a.value), a.derivative / a.value); };
+
+inline Dual sqrt(const Dual& a)
+{
+	double s = std::sqrt(a.value);
+	return Dual(s, a.derivative / (2 * s));
+};
+
+inline Dual erfc(const Dual& a)
+{
+	return Dual(std::erfc(a.value), -1.12837916709551257390 * std::exp(-a.value * a.value) * a.derivative); // 2/sqrt(pi)
+};
+
+inline Dual pow(const Dual& a, const double& p)
+{
+	double r = std::pow(a.value, p);
+	return Dual(r, p * std::pow(a.value, p - 1) * a.derivative);
+};
@@ -0,0 +1,185 @@
+#include "Hot_Path_Counters.h"
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+
+/**
+* Project:    Project 1
+* Filename:   Hot_Path_Counters.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Thread local counters of the volatility and yield solvers and the Black kernels, merged into snapshots on read.
+*/
+
+
+#if !defined(RATE_DERIVATIVES_NO_COUNTERS)
+namespace
+{
+	const int n_fields = 5 + Counter_Snapshot::histogram_size; // calls, pricings, iterations, failures, bracket failures, histogram
+
+	struct Thread_Counters
+	{
+		std::atomic<std::uint64_t> values[Hot_Path_Counters::n_sites][n_fields] = {};
+	};
+
+	struct Counter_Registry
+	{
+		std::mutex mutex;
+		std::vector<const Thread_Counters*> live; // one per thread that has recorded and not exited
+		std::uint64_t retired[Hot_Path_Counters::n_sites][n_fields] = {}; // totals of the exited threads
+	};
+
+
+	/**
+	* Function to return the registry, created on first use and never destroyed so pool threads exiting during
+	* static destruction can still retire their counters.
+	*/
+	Counter_Registry& registry()
+	{
+		static Counter_Registry* counters = new Counter_Registry;
+		return *counters;
+	}
+
+
+	/**
+	* Counters of the calling thread, registered on construction and folded into the retired totals on exit.
+	*/
+	struct Thread_Registration
+	{
+		Thread_Counters counters;
+
+		Thread_Registration()
+		{
+			Counter_Registry& r = registry();
+			std::lock_guard<std::mutex> lock(r.mutex);
+			r.live.push_back(&counters);
+		}
+
+		~Thread_Registration()
+		{
+			Counter_Registry& r = registry();
+			std::lock_guard<std::mutex> lock(r.mutex);
+			for (int s = 0; s < Hot_Path_Counters::n_sites; s++)
+			{
+				for (int f = 0; f < n_fields; f++)
+				{
+					r.retired[s][f] += counters.values[s][f].load(std::memory_order_relaxed);
+				}
+			}
+			for (std::size_t i = 0; i < r.live.size(); i++)
+			{
+				if (r.live[i] == &counters)
+				{
+					r.live[i] = r.live.back();
+					r.live.pop_back();
+					break;
+				}
+			}
+		}
+	};
+
+	thread_local Thread_Registration thread_counters;
+
+
+	/**
+	* Function to add to a counter only this thread writes, without a locked read-modify-write.
+	*/
+	inline void add(std::atomic<std::uint64_t>& counter, const std::uint64_t& amount)
+	{
+		counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+	}
+}
+
+
+/**
+* Function to record one solver call on the calling thread.
+* @param site const Counter_Site reference, denotes the solver called.
+* @param iterations const int reference, denotes the iterations the call used.
+* @param failed const boolean reference, denotes whether the call did not converge or returned NaN.
+* @param bracket_failure const boolean reference, denotes whether the price was outside the solver's interval.
+*/
+void Hot_Path_Counters::record(const Counter_Site& site, const int& iterations, const bool& failed, const bool& bracket_failure)
+{
+	std::atomic<std::uint64_t>* values = thread_counters.counters.values[site];
+	int bin = iterations < 0 ? 0 : (iterations < Counter_Snapshot::histogram_size - 1 ? iterations : Counter_Snapshot::histogram_size - 1);
+	add(values[0], 1);
+	add(values[2], std::uint64_t(iterations < 0 ? 0 : iterations));
+	if (failed || bracket_failure)
+	{
+		add(values[3], 1);
+	}
+	if (bracket_failure)
+	{
+		add(values[4], 1);
+	}
+	add(values[5 + bin], 1);
+}
+
+
+/**
+* Function to record one pricing kernel call on the calling thread.
+* @param site const Counter_Site reference, denotes the kernel called.
+* @param n const uint64_t reference, denotes the number of options the call priced.
+*/
+void Hot_Path_Counters::record_pricings(const Counter_Site& site, const std::uint64_t& n)
+{
+	std::atomic<std::uint64_t>* values = thread_counters.counters.values[site];
+	add(values[0], 1);
+	add(values[1], n);
+}
+#endif
+
+
+/**
+* Function to return the counters of a solver summed over every thread, live or exited.
+* @param site const Counter_Site reference, denotes the solver.
+*/
+Counter_Snapshot Hot_Path_Counters::snapshot([[maybe_unused]] const Counter_Site& site)
+{
+	Counter_Snapshot result;
+#if !defined(RATE_DERIVATIVES_NO_COUNTERS)
+	std::uint64_t totals[n_fields];
+	Counter_Registry& r = registry();
+	{
+		std::lock_guard<std::mutex> lock(r.mutex);
+		for (int f = 0; f < n_fields; f++)
+		{
+			totals[f] = r.retired[site][f];
+		}
+		for (auto &thread : r.live)
+		{
+			for (int f = 0; f < n_fields; f++)
+			{
+				totals[f] += thread->values[site][f].load(std::memory_order_relaxed);
+			}
+		}
+	}
+	result.calls = totals[0];
+	result.pricings = totals[1];
+	result.iterations = totals[2];
+	result.failures = totals[3];
+	result.bracket_failures = totals[4];
+	for (int b = 0; b < Counter_Snapshot::histogram_size; b++)
+	{
+		result.histogram[b] = totals[5 + b];
+	}
+#endif
+	return result;
+}
+
+
+/**
+* Function to return the name of a counter site for reporting.
+* @param site const Counter_Site reference, denotes the solver.
+*/
+const char* Hot_Path_Counters::get_site_name(const Counter_Site& site)
+{
+	switch (site)
+	{
+	case Counter_Volatility: return "Implied_Volatility::solve and solve_from";
+	case Counter_Yield: return "Yield_Solver::solve and Bond::ytm";
+	case Counter_Black: return "Black_Simd::prices and optionlet_values";
+	}
+	return "Unknown";
+}
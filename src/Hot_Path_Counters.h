@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+* Project:    Project 1
+* Filename:   Hot_Path_Counters.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Thread local counters of the volatility and yield solvers and the Black kernels, merged into snapshots on read.
+*
+* The solvers record every call, so the batch paths built on them (Optionlet_Batch, Vol_Surface, Vol_Calibration,
+* Sabr_Calibration, Bond_Book) are counted as well as the single object ones. The Black kernels record each batch
+* and the number of options it priced.
+*
+* Each thread owns its counters and updates them with plain (relaxed, lock free) stores, so recording costs a
+* few instructions and never contends with another pricing thread. snapshot() sums every live thread and the
+* totals of the threads that have exited, taking a lock the pricing threads only touch when they first record
+* and when they exit, so monitoring can scrape at any rate. Counts read during pricing may be a few calls
+* behind. Configuring with -DRATE_DERIVATIVES_COUNTERS=OFF defines RATE_DERIVATIVES_NO_COUNTERS, which turns
+* record() into an empty inline function and snapshots into zeros.
+*/
+enum Counter_Site
+{
+	Counter_Volatility = 0, // Implied_Volatility::solve and solve_from
+	Counter_Yield = 1, // Yield_Solver::solve and Bond::ytm
+	Counter_Black = 2 // Black_Simd::prices and optionlet_values
+};
+
+struct Counter_Snapshot
+{
+	static const int histogram_size = 33; // calls by solver iterations, 0 to 31 and the last for 32 or more
+
+	std::uint64_t calls{ 0 }; // solver calls, or kernel calls for Counter_Black
+	std::uint64_t pricings{ 0 }; // options priced (Counter_Black only)
+	std::uint64_t iterations{ 0 }; // solver iterations summed over the calls
+	std::uint64_t failures{ 0 }; // calls not converged or returning NaN (bracket failures included)
+	std::uint64_t bracket_failures{ 0 }; // price outside the solver's interval (volatility only)
+	std::uint64_t histogram[histogram_size] = {};
+};
+
+
+class Hot_Path_Counters
+{
+public:
+	static const int n_sites = 3;
+
+#if defined(RATE_DERIVATIVES_NO_COUNTERS)
+	static constexpr bool enabled = false;
+	static void record(const Counter_Site&, const int&, const bool&, const bool&) {};
+	static void record_pricings(const Counter_Site&, const std::uint64_t&) {};
+#else
+	static constexpr bool enabled = true;
+	static void record(const Counter_Site& site, const int& iterations, const bool& failed, const bool& bracket_failure); // one solver call on this thread
+	static void record_pricings(const Counter_Site& site, const std::uint64_t& n); // one kernel call pricing n options on this thread
+#endif
+
+	// Reporting
+	static Counter_Snapshot snapshot(const Counter_Site& site); // totals over every thread since the start of the process
+	static const char* get_site_name(const Counter_Site& site);
+};
@@ -0,0 +1,310 @@
+#include "Implied_Volatility.h"
+#include "Black_Formula.h"
+#include "Hot_Path_Counters.h"
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+
+/**
+* Project:    Project 1
+* Filename:   Implied_Volatility.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Bounded Halley solver inverting Black's formula for caplet and floorlet volatilities.
+*/
+
+
+namespace
+{
+	const double pi = 3.14159265358979323846;
+
+	/**
+	* Function to compute the PDF of the standard normal distribution.
+	*/
+	inline double pdf_normal(const double& x)
+	{
+		return 0.398942280401432677940 * exp(-0.5 * x * x);
+	}
+
+	/**
+	* Function to produce a starting volatility from the undiscounted price of the option.
+	* Uses the rational approximation of Corrado & Miller (1996), falling back on the inflection
+	* point of the price curve sqrt(2|log(F/K)|/t) when the approximation breaks down.
+	*/
+	double initial_volatility(const double& target, const double& forward, const double& strike, const double& sqrt_t, const bool& call)
+	{
+		double call_value = call ? target : target + (forward - strike); // put-call parity
+		double a = call_value - 0.5 * (forward - strike);
+		double radicand = a * a - (forward - strike) * (forward - strike) / pi;
+		double guess = sqrt(2. * pi) / (forward + strike) * (a + sqrt(radicand > 0 ? radicand : 0.)) / sqrt_t;
+
+		if (!(radicand > 0) || !(guess > 0))
+		{
+			guess = sqrt(2. * fabs(log(forward / strike))) / sqrt_t;
+		}
+		return guess;
+	}
+
+	/**
+	* Function to polish a volatility with Halley steps on the log price of the out-of-the-money option, using the
+	* analytic vega and volga. Any step leaving the bracket [lo, hi] is replaced by bisection. Fills the volatility,
+	* status (Vol_Converged or Vol_Max_Iterations) and number of Black evaluations of the result.
+	*/
+	void halley_iterations(const double& forward, const double& strike, const double& sqrt_t, const bool& otm_call, const double& otm_target,
+		const double& tol, double lo, double hi, double vol, Vol_Result& result)
+	{
+		double log_target = log(otm_target);
+		for (int i = 1; i <= Implied_Volatility::max_iterations; i++)
+		{
+			double d1, d2;
+			double value = black_value(forward, strike, vol * sqrt_t, otm_call, d1, d2);
+			result.iterations = i;
+
+			if (fabs(value - otm_target) <= tol)
+			{
+				result.volatility = vol;
+				result.status = Vol_Converged;
+				return;
+			}
+
+			// The price is increasing in vol, so the sign of the error tells us which end of the bracket to move
+			if (value > otm_target)
+			{
+				hi = vol;
+			}
+			else {
+				lo = vol;
+			}
+
+			// Halley step on y = log(value) - log(target), which stays well scaled for far out-of-the-money options:
+			// vol - 2 y y' / (2 y'^2 - y y'') with y' = vega / value and y'' = volga / value - y'^2
+			double next = lo;
+			if (value > 0)
+			{
+				double vega = forward * pdf_normal(d1) * sqrt_t;
+				double volga = vega * d1 * d2 / vol;
+				double y = log(value) - log_target;
+				double dy = vega / value;
+				double d2y = volga / value - dy * dy;
+				double denominator = 2. * dy * dy - y * d2y;
+				if (dy > 0 && denominator > 0)
+				{
+					next = vol - 2. * y * dy / denominator;
+				}
+			}
+			if (!(next > lo && next < hi))
+			{
+				next = (hi > 4. * lo) ? sqrt(lo * hi) : 0.5 * (lo + hi); // bisect in log(vol) while the bracket is wide
+			}
+			vol = next;
+		}
+
+		result.volatility = vol;
+		result.status = Vol_Max_Iterations;
+	}
+
+	/**
+	* Function to count one solver call (see Hot_Path_Counters.h).
+	*/
+	inline void record(const Vol_Result& result)
+	{
+		Hot_Path_Counters::record(Counter_Volatility, result.iterations, result.status != Vol_Converged || std::isnan(result.volatility),
+			result.status == Vol_Below_Minimum || result.status == Vol_Above_Maximum);
+	}
+}
+
+
+/**
+* Function to infer the volatility of a caplet (call = true) or floorlet (call = false) from its price.
+* The price is first checked against the prices at the ends of the search interval, and the root is then
+* polished with Halley steps on the log price of the out-of-the-money option, using the analytic vega and volga. Any step leaving the current bracket is
+* replaced by bisection, so at most max_iterations Black evaluations are made after the two end point checks.
+* @param option_price const double reference, denotes the fair price of the option.
+* @param forward const double reference, denotes the forward rate.
+* @param strike const double reference, denotes the strike of the option.
+* @param t_1 const double reference, denotes the time (days) at which the rate is set.
+* @param discount const double reference, denotes the ZCB price at the payment date.
+* @param call const boolean reference, denotes whether the option is a caplet(true) or floorlet(false).
+* @param tolerance const double reference, denotes the absolute error allowed on the option price.
+*/
+Vol_Result Implied_Volatility::solve_uncounted(const double& option_price, const double& forward, const double& strike, const double& t_1, const double& discount, const bool& call, const double& tolerance)
+{
+	Vol_Result result{ std::numeric_limits<double>::quiet_NaN(), 0, Vol_Invalid_Input };
+
+	if (!(forward > 0) || !(strike > 0) || !(t_1 > 0) || !(discount > 0) || !(option_price >= 0) || !std::isfinite(option_price))
+	{
+		return result;
+	}
+
+	// Work with the undiscounted premium
+	double sqrt_t = sqrt(t_1 / 365.);
+	double target = option_price / discount;
+	double tol = tolerance / discount;
+
+	// Choose interval [lo, hi] s.t. y(lo)y(hi)<0
+	double lo = min_volatility;
+	double hi = max_volatility;
+	double y_lo = black(forward, strike, lo * sqrt_t, call) - target;
+	if (y_lo > tol)
+	{
+		result.status = Vol_Below_Minimum;
+		return result;
+	}
+	double y_hi = black(forward, strike, hi * sqrt_t, call) - target;
+	if (y_hi < -tol)
+	{
+		result.status = Vol_Above_Maximum;
+		return result;
+	}
+
+	if (fabs(y_lo) <= tol || fabs(y_hi) <= tol)
+	{
+		result.volatility = fabs(y_lo) <= tol ? lo : hi;
+		result.status = Vol_Converged;
+		return result;
+	}
+
+	// Solve for the out-of-the-money option (no intrinsic value) with the same volatility (put-call parity)
+	bool otm_call = forward < strike;
+	double otm_target = target - (call == otm_call ? 0. : (call ? forward - strike : strike - forward));
+	if (!(otm_target > 0))
+	{
+		result.volatility = lo;
+		result.status = Vol_Converged;
+		return result;
+	}
+	double vol = initial_volatility(target, forward, strike, sqrt_t, call);
+	if (!(vol > lo && vol < hi))
+	{
+		vol = (hi > 4. * lo) ? sqrt(lo * hi) : 0.5 * (lo + hi);
+	}
+
+	halley_iterations(forward, strike, sqrt_t, otm_call, otm_target, tol, lo, hi, vol, result);
+	return result;
+}
+
+
+/**
+* Function to infer a volatility starting from a guess, typically the volatility implied for the same option on
+* the previous tick. The end point checks of solve are skipped and the Halley steps start at the guess within the
+* whole search interval, so a good guess converges in one or two Black evaluations. If the solve does not
+* converge (e.g. the price has left the attainable range), it falls back on solve_uncounted, which classifies the
+* failure; the evaluations of both attempts are counted.
+* @param option_price const double reference, denotes the fair price of the option.
+* @param forward const double reference, denotes the forward rate.
+* @param strike const double reference, denotes the strike of the option.
+* @param t_1 const double reference, denotes the time (days) at which the rate is set.
+* @param discount const double reference, denotes the ZCB price at the payment date.
+* @param call const boolean reference, denotes whether the option is a caplet(true) or floorlet(false).
+* @param guess const double reference, denotes the starting volatility.
+* @param tolerance const double reference, denotes the absolute error allowed on the option price.
+*/
+Vol_Result Implied_Volatility::solve_from_uncounted(const double& option_price, const double& forward, const double& strike, const double& t_1, const double& discount, const bool& call, const double& guess, const double& tolerance)
+{
+	if (!(guess > min_volatility && guess < max_volatility) || !(forward > 0) || !(strike > 0) || !(t_1 > 0) || !(discount > 0) || !(option_price >= 0) || !std::isfinite(option_price))
+	{
+		return solve_uncounted(option_price, forward, strike, t_1, discount, call, tolerance);
+	}
+
+	double sqrt_t = sqrt(t_1 / 365.);
+	double target = option_price / discount;
+	bool otm_call = forward < strike;
+	double otm_target = target - (call == otm_call ? 0. : (call ? forward - strike : strike - forward));
+	if (!(otm_target > 0))
+	{
+		return solve_uncounted(option_price, forward, strike, t_1, discount, call, tolerance);
+	}
+
+	Vol_Result result{ std::numeric_limits<double>::quiet_NaN(), 0, Vol_Max_Iterations };
+	halley_iterations(forward, strike, sqrt_t, otm_call, otm_target, tolerance / discount, min_volatility, max_volatility, guess, result);
+	if (result.status == Vol_Converged)
+	{
+		return result;
+	}
+
+	int warm_iterations = result.iterations;
+	result = solve_uncounted(option_price, forward, strike, t_1, discount, call, tolerance);
+	result.iterations += warm_iterations;
+	return result;
+}
+
+
+/**
+* Function to infer the volatility of a caplet (call = true) or floorlet (call = false) from its price and count
+* the call (see solve_uncounted). Parameters as for solve_uncounted.
+*/
+Vol_Result Implied_Volatility::solve(const double& option_price, const double& forward, const double& strike, const double& t_1, const double& discount, const bool& call, const double& tolerance)
+{
+	Vol_Result result = solve_uncounted(option_price, forward, strike, t_1, discount, call, tolerance);
+	record(result);
+	return result;
+}
+
+
+/**
+* Function to infer a volatility starting from a guess and count the call once, fallback included (see
+* solve_from_uncounted). Parameters as for solve_from_uncounted.
+*/
+Vol_Result Implied_Volatility::solve_from(const double& option_price, const double& forward, const double& strike, const double& t_1, const double& discount, const bool& call, const double& guess, const double& tolerance)
+{
+	Vol_Result result = solve_from_uncounted(option_price, forward, strike, t_1, discount, call, guess, tolerance);
+	record(result);
+	return result;
+}
+
+
+/**
+* Function to compute the undiscounted Black price of a caplet (call = true) or floorlet (call = false).
+* @param forward const double reference, denotes the forward rate.
+* @param strike const double reference, denotes the strike of the option.
+* @param std_dev const double reference, denotes the volatility multiplied by sqrt(t_1/365).
+* @param call const boolean reference, denotes whether the option is a caplet(true) or floorlet(false).
+*/
+double Implied_Volatility::black(const double& forward, const double& strike, const double& std_dev, const bool& call)
+{
+	return black_value(forward, strike, std_dev, call);
+}
+
+
+/**
+* Function to return a printable name for a solver status.
+* @param status const Vol_Status reference, denotes the solver status.
+*/
+const char* Implied_Volatility::get_status_name(const Vol_Status& status)
+{
+	switch (status)
+	{
+	case Vol_Converged: return "converged";
+	case Vol_Max_Iterations: return "maximum iterations reached";
+	case Vol_Below_Minimum: return "price below minimum";
+	case Vol_Above_Maximum: return "price above maximum";
+	default: return "invalid input";
+	}
+}
+
+
+/**
+* Function to print a warning to the console for results that did not converge.
+* @param result const Vol_Result reference, denotes the outcome of a solve.
+*/
+void Implied_Volatility::print_warning(const Vol_Result& result)
+{
+	if (result.status == Vol_Below_Minimum)
+	{
+		std::cout << "WARNING: negative volatility implied. NaN volatility returned." << std::endl;
+	}
+	else if (result.status == Vol_Above_Maximum)
+	{
+		std::cout << "WARNING: volatility above the search interval implied. NaN volatility returned." << std::endl;
+	}
+	else if (result.status == Vol_Max_Iterations)
+	{
+		std::cout << "WARNING: volatility solver reached its iteration limit. Best estimate returned." << std::endl;
+	}
+	else if (result.status == Vol_Invalid_Input)
+	{
+		std::cout << "WARNING: invalid inputs to the volatility solver. NaN volatility returned." << std::endl;
+	}
+	return;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+
+/**
+* Project:    Project 1
+* Filename:   Implied_Volatility.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Bounded Halley solver inverting Black's formula for caplet and floorlet volatilities.
+*/
+
+enum Vol_Status
+{
+	Vol_Converged = 0, // price recovered to within the tolerance
+	Vol_Max_Iterations = 1, // iteration cap reached, best estimate returned
+	Vol_Below_Minimum = 2, // price below the value at the minimum volatility (e.g. below intrinsic), NaN returned
+	Vol_Above_Maximum = 3, // price above the value at the maximum volatility, NaN returned
+	Vol_Invalid_Input = 4 // non-positive or non-finite forward, strike, time, discount factor or price, NaN returned
+};
+
+struct Vol_Result
+{
+	double volatility;
+	int iterations; // number of Black price evaluations after the bracket check
+	Vol_Status status;
+};
+
+
+class Implied_Volatility
+{
+private:
+	// Solver bodies, counted by the public wrappers (see Hot_Path_Counters.h)
+	static Vol_Result solve_uncounted(const double& option_price, const double& forward, const double& strike, const double& t_1, const double& discount, const bool& call, const double& tolerance);
+	static Vol_Result solve_from_uncounted(const double& option_price, const double& forward, const double& strike, const double& t_1, const double& discount, const bool& call, const double& guess, const double& tolerance);
+
+public:
+	// Search interval and limits
+	static constexpr double min_volatility = 0.000000001;
+	static constexpr double max_volatility = 0.99999999999;
+	static constexpr double default_tolerance = 0.000000001; // absolute error on the option price
+	static constexpr int max_iterations = 16;
+
+	// Solver
+	static Vol_Result solve(const double& option_price, const double& forward, const double& strike, const double& t_1, const double& discount, const bool& call, const double& tolerance = default_tolerance);
+	static Vol_Result solve_from(const double& option_price, const double& forward, const double& strike, const double& t_1, const double& discount, const bool& call, const double& guess, const double& tolerance = default_tolerance);
+
+	// Black's formula for the undiscounted premium, std_dev = vol * sqrt(t_1/365)
+	static double black(const double& forward, const double& strike, const double& std_dev, const bool& call);
+
+	// Reporting
+	static const char* get_status_name(const Vol_Status& status);
+	static void print_warning(const Vol_Result& result);
+};
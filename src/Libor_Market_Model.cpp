@@ -0,0 +1,364 @@
+#include "Libor_Market_Model.h"
+#include "Batch_Validation.h"
+#include "Black_Simd.h"
+#include "Counter_Rng.h"
+#include "Optionlet_Batch.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+
+/**
+* Project:    Project 1
+* Filename:   Libor_Market_Model.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Multi-threaded LIBOR Market Model Monte Carlo engine for caps, floors and path-dependent rate products.
+*/
+
+
+/**
+* Constructor for a LIBOR Market Model on the periods of a set of zero rates. The ZCB prices at the pillars are
+* computed as in Term_Structure.cpp, and forward i is the simple rate (P_i / P_i+1 - 1) / tau_i over its period,
+* so that the rolling numeraire reprices the curve exactly.
+* @param vols const vector double reference, denotes the caplet volatility of each forward (N entries).
+* @param rates const vector double reference, denotes the interest rates at each discrete time interval t_i (N+1 entries).
+* @param time_of_rates const vector usigned int reference, denotes the times at which each of the rates occurs.
+* @param correlation_decay const double reference, denotes beta in the correlation exp(-beta |t_i - t_j|) (t in years).
+* @param steps const unsigned int reference, denotes the number of time steps between consecutive fixing dates.
+*/
+Libor_Market_Model::Libor_Market_Model(const std::vector<double>& vols, const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const double& correlation_decay, const unsigned int& steps)
+{
+	std::size_t n = vols.size();
+	if (n == 0 || rates.size() != n + 1 || time_of_rates.size() != n + 1)
+	{
+		throw 3; // Check that for N forwards, N + 1 rates and times, as well as, N volatilities have been given.
+	}
+
+	Input_Status status = Batch_Validation::validate_curve(rates.data(), time_of_rates.data(), rates.size());
+	if (status != Input_Valid)
+	{
+		throw int(status);
+	}
+	if (!(correlation_decay >= 0) || steps == 0)
+	{
+		throw 2;
+	}
+
+	forward_rates.resize(n);
+	accruals.resize(n);
+	volatilities = vols;
+	fixing_times.resize(n);
+	payment_discounts.resize(n);
+	correlations.resize(n);
+	steps_per_period = steps;
+
+	double price_1 = exp(-1 * rates[0] * (time_of_rates[0] / double(365)));
+	first_discount = price_1;
+	for (std::size_t i = 0; i < n; i++)
+	{
+		if (!(vols[i] >= 0))
+		{
+			throw 2; // Ensure all parameters take reasonable values.
+		}
+		double price_2 = exp(-1 * rates[i + 1] * (time_of_rates[i + 1] / double(365)));
+		accruals[i] = (time_of_rates[i + 1] - time_of_rates[i]) / 365.;
+		forward_rates[i] = (price_1 / price_2 - 1) / accruals[i];
+		if (!(forward_rates[i] > 0))
+		{
+			throw 2; // Lognormal forwards must be positive.
+		}
+		fixing_times[i] = time_of_rates[i];
+		payment_discounts[i] = price_2;
+		correlations[i] = i > 0 ? exp(-correlation_decay * (time_of_rates[i] - time_of_rates[i - 1]) / 365.) : 0.;
+		price_1 = price_2;
+	}
+}
+
+
+/**
+* Function to simulate one block of paths. Every quantity is held as one array per forward with one entry
+* per path (lane) of the block, so the inner loops run over contiguous lanes and the exponentials go through
+* the vector kernel (see Black_Simd.h). Correlated normals follow from the Markov structure of the correlation:
+* z_i = a_i z_i-1 + sqrt(1 - a_i^2) w_i, with a_i = exp(-beta (t_i - t_i-1)), in O(N) per step, and so does the
+* spot measure drift sigma_i sum_{k<=j<=i} rho_ij tau_j sigma_j L_j / (1 + tau_j L_j) through a running sum.
+* @param seed const uint64 reference, denotes the seed of the simulation.
+* @param first_path const uint64 reference, denotes the index of the first path of the block.
+* @param n_lanes const size_t reference, denotes the number of paths of the block (at most lanes).
+* @param fixings double pointer, denotes the output fixing of each forward on each path (N x lanes).
+* @param deflators double pointer, denotes the output value today of 1 paid at each payment date on each path (N x lanes).
+* @param workspace double pointer, denotes scratch space of (5 N + 1) x lanes doubles.
+*/
+void Libor_Market_Model::simulate_block(const std::uint64_t& seed, const std::uint64_t& first_path, const std::size_t& n_lanes, double* fixings, double* deflators, double* workspace) const
+{
+	const std::size_t n = forward_rates.size();
+	double* log_forwards = workspace;
+	double* forwards = log_forwards + n * lanes;
+	double* shocks = forwards + n * lanes;
+	double* drifts = shocks + n * lanes;
+	double* predicted = drifts + n * lanes;
+	double* sums = predicted + n * lanes;
+
+	for (std::size_t i = 0; i < n; i++)
+	{
+		double log_forward = log(forward_rates[i]);
+		for (std::size_t l = 0; l < lanes; l++)
+		{
+			log_forwards[i * lanes + l] = log_forward;
+			forwards[i * lanes + l] = forward_rates[i];
+		}
+	}
+	double numeraire[lanes];
+	for (std::size_t l = 0; l < lanes; l++)
+	{
+		numeraire[l] = first_discount; // P(0, t_0) / B(t): the bank account rolls from the first pillar
+	}
+
+	std::uint32_t step = 0;
+	for (std::size_t k = 0; k < n; k++) // period ending at the fixing of forward k, forwards k..N-1 alive
+	{
+		double dt = (fixing_times[k] - (k > 0 ? fixing_times[k - 1] : 0.)) / 365. / steps_per_period;
+		double sqrt_dt = sqrt(dt);
+		std::size_t alive = (n - k) * lanes;
+
+		for (unsigned int m = 0; m < steps_per_period; m++, step++)
+		{
+			// Independent normals, a pure function of (seed, path, step, forward)
+			for (std::size_t l = 0; l < n_lanes; l++)
+			{
+				for (std::size_t i = k; i < n; i += 2)
+				{
+					double z_1, z_2;
+					Counter_Rng::normal_pair(seed, first_path + l, step, std::uint32_t(i), z_1, z_2);
+					shocks[i * lanes + l] = z_1;
+					if (i + 1 < n)
+					{
+						shocks[(i + 1) * lanes + l] = z_2;
+					}
+				}
+			}
+			// Correlate neighbouring forwards
+			for (std::size_t i = k + 1; i < n; i++)
+			{
+				double a = correlations[i];
+				double b = sqrt(1 - a * a);
+				for (std::size_t l = 0; l < lanes; l++)
+				{
+					shocks[i * lanes + l] = a * shocks[(i - 1) * lanes + l] + b * shocks[i * lanes + l];
+				}
+			}
+
+			// Predictor: drift at the start of the step
+			for (std::size_t l = 0; l < lanes; l++)
+			{
+				sums[l] = 0;
+			}
+			for (std::size_t i = k; i < n; i++)
+			{
+				double a = i > k ? correlations[i] : 0.;
+				double coefficient = accruals[i] * volatilities[i];
+				double vol = volatilities[i];
+				double convexity = 0.5 * vol * vol * dt;
+				double diffusion = vol * sqrt_dt;
+				for (std::size_t l = 0; l < lanes; l++)
+				{
+					double x = forwards[i * lanes + l];
+					sums[l] = a * sums[l] + coefficient * x / (1 + accruals[i] * x);
+					drifts[i * lanes + l] = vol * sums[l];
+					predicted[i * lanes + l] = log_forwards[i * lanes + l] + drifts[i * lanes + l] * dt - convexity + diffusion * shocks[i * lanes + l];
+				}
+			}
+			Black_Simd::exponentials(predicted + k * lanes, forwards + k * lanes, alive);
+
+			// Corrector: average of the drifts at the start and at the predicted end of the step
+			for (std::size_t l = 0; l < lanes; l++)
+			{
+				sums[l] = 0;
+			}
+			for (std::size_t i = k; i < n; i++)
+			{
+				double a = i > k ? correlations[i] : 0.;
+				double coefficient = accruals[i] * volatilities[i];
+				double vol = volatilities[i];
+				double convexity = 0.5 * vol * vol * dt;
+				double diffusion = vol * sqrt_dt;
+				for (std::size_t l = 0; l < lanes; l++)
+				{
+					double x = forwards[i * lanes + l];
+					sums[l] = a * sums[l] + coefficient * x / (1 + accruals[i] * x);
+					double drift = 0.5 * (drifts[i * lanes + l] + vol * sums[l]);
+					log_forwards[i * lanes + l] += drift * dt - convexity + diffusion * shocks[i * lanes + l];
+				}
+			}
+			Black_Simd::exponentials(log_forwards + k * lanes, forwards + k * lanes, alive);
+		}
+
+		// Forward k fixes, and the numeraire rolls over its period
+		for (std::size_t l = 0; l < lanes; l++)
+		{
+			double fixing = forwards[k * lanes + l];
+			numeraire[l] /= 1 + accruals[k] * fixing;
+			fixings[k * lanes + l] = fixing;
+			deflators[k * lanes + l] = numeraire[l];
+		}
+	}
+}
+
+
+/**
+* Function to price every forward as a caplet and a floorlet by Monte Carlo. The paths are split into fixed
+* chunks spread over the threads of the pool, and the per-chunk sums are added in chunk order, so the prices
+* are identical whatever the number of threads. The closed form Black prices on the same forwards and vols
+* are computed alongside: the Monte Carlo prices should agree to within a few standard errors.
+* @param strikes const vector double reference, denotes the strike of each optionlet (N entries).
+* @param n_paths const size_t reference, denotes the number of paths.
+* @param seed const uint64 reference, denotes the seed of the simulation.
+* @param pool Thread_Pool reference, denotes the threads used for the simulation.
+*/
+void Libor_Market_Model::price_optionlets(const std::vector<double>& strikes, const std::size_t& n_paths, const std::uint64_t& seed, Thread_Pool& pool)
+{
+	const std::size_t n = forward_rates.size();
+	if (strikes.size() != n)
+	{
+		throw 3;
+	}
+	for (auto &k : strikes)
+	{
+		if (!(k >= 0))
+		{
+			throw 2;
+		}
+	}
+
+	std::size_t n_chunks = (n_paths + chunk_paths - 1) / chunk_paths;
+	std::vector<double> partial(n_chunks * 4 * n, 0.); // cap sum, cap sum of squares, floor sum, floor sum of squares
+	pool.parallel_for(n_chunks, [&](std::size_t begin, std::size_t end)
+	{
+		std::vector<double> fixings(n * lanes), deflators(n * lanes), workspace((5 * n + 1) * lanes);
+		for (std::size_t c = begin; c < end; c++)
+		{
+			double* sums = &partial[c * 4 * n];
+			std::size_t last = std::min(n_paths, (c + 1) * chunk_paths);
+			for (std::size_t p = c * chunk_paths; p < last; p += lanes)
+			{
+				std::size_t n_lanes = std::min(lanes, last - p);
+				simulate_block(seed, p, n_lanes, fixings.data(), deflators.data(), workspace.data());
+				for (std::size_t i = 0; i < n; i++)
+				{
+					for (std::size_t l = 0; l < n_lanes; l++)
+					{
+						double fixing = fixings[i * lanes + l];
+						double cap = deflators[i * lanes + l] * std::max(fixing - strikes[i], 0.);
+						double floor = deflators[i * lanes + l] * std::max(strikes[i] - fixing, 0.);
+						sums[4 * i] += cap;
+						sums[4 * i + 1] += cap * cap;
+						sums[4 * i + 2] += floor;
+						sums[4 * i + 3] += floor * floor;
+					}
+				}
+			}
+		}
+	}, 1);
+
+	std::vector<double> totals(4 * n, 0.);
+	for (std::size_t c = 0; c < n_chunks; c++)
+	{
+		for (std::size_t j = 0; j < 4 * n; j++)
+		{
+			totals[j] += partial[c * 4 * n + j];
+		}
+	}
+
+	cap_prices.resize(n);
+	floor_prices.resize(n);
+	cap_errors.resize(n);
+	floor_errors.resize(n);
+	for (std::size_t i = 0; i < n; i++)
+	{
+		cap_prices[i] = totals[4 * i] / n_paths;
+		floor_prices[i] = totals[4 * i + 2] / n_paths;
+		cap_errors[i] = sqrt(std::max(totals[4 * i + 1] / n_paths - cap_prices[i] * cap_prices[i], 0.) / n_paths);
+		floor_errors[i] = sqrt(std::max(totals[4 * i + 3] / n_paths - floor_prices[i] * floor_prices[i], 0.) / n_paths);
+	}
+	paths_simulated = n_paths;
+
+	black_cap_prices.resize(n);
+	black_floor_prices.resize(n);
+	Optionlet_Batch::caplet_prices(strikes.data(), volatilities.data(), forward_rates.data(), fixing_times.data(), payment_discounts.data(), black_cap_prices.data(), n);
+	Optionlet_Batch::floorlet_prices(strikes.data(), volatilities.data(), forward_rates.data(), fixing_times.data(), payment_discounts.data(), black_floor_prices.data(), n);
+}
+
+
+/**
+* Function to price a path-dependent product by Monte Carlo. On each path the payoff is handed the fixings
+* of every forward and returns the cashflow paid at the end of each period, which is discounted with the
+* numeraire of the path. The payoff is called concurrently from the threads of the pool.
+* @param payoff const function reference, called with the N fixings of a path to fill its N cashflows.
+* @param n_paths const size_t reference, denotes the number of paths.
+* @param seed const uint64 reference, denotes the seed of the simulation.
+* @param std_error double reference, denotes the standard error of the price.
+* @param pool Thread_Pool reference, denotes the threads used for the simulation.
+* Returns the price of the product.
+*/
+double Libor_Market_Model::price_path_dependent(const std::function<void(const double* fixings, double* cashflows)>& payoff, const std::size_t& n_paths, const std::uint64_t& seed, double& std_error, Thread_Pool& pool)
+{
+	const std::size_t n = forward_rates.size();
+	std::size_t n_chunks = (n_paths + chunk_paths - 1) / chunk_paths;
+	std::vector<double> partial(n_chunks * 2, 0.);
+	pool.parallel_for(n_chunks, [&](std::size_t begin, std::size_t end)
+	{
+		std::vector<double> fixings(n * lanes), deflators(n * lanes), workspace((5 * n + 1) * lanes);
+		std::vector<double> path_fixings(n), cashflows(n);
+		for (std::size_t c = begin; c < end; c++)
+		{
+			std::size_t last = std::min(n_paths, (c + 1) * chunk_paths);
+			for (std::size_t p = c * chunk_paths; p < last; p += lanes)
+			{
+				std::size_t n_lanes = std::min(lanes, last - p);
+				simulate_block(seed, p, n_lanes, fixings.data(), deflators.data(), workspace.data());
+				for (std::size_t l = 0; l < n_lanes; l++)
+				{
+					for (std::size_t i = 0; i < n; i++)
+					{
+						path_fixings[i] = fixings[i * lanes + l];
+						cashflows[i] = 0;
+					}
+					payoff(path_fixings.data(), cashflows.data());
+					double value = 0;
+					for (std::size_t i = 0; i < n; i++)
+					{
+						value += deflators[i * lanes + l] * cashflows[i];
+					}
+					partial[2 * c] += value;
+					partial[2 * c + 1] += value * value;
+				}
+			}
+		}
+	}, 1);
+
+	double sum = 0;
+	double sum_squares = 0;
+	for (std::size_t c = 0; c < n_chunks; c++)
+	{
+		sum += partial[2 * c];
+		sum_squares += partial[2 * c + 1];
+	}
+	double price = sum / n_paths;
+	std_error = sqrt(std::max(sum_squares / n_paths - price * price, 0.) / n_paths);
+	return price;
+}
+
+
+/**
+* Function to print the Monte Carlo and closed form prices of the optionlets to the console.
+*/
+void Libor_Market_Model::print_comparison()
+{
+	std::cout << "LMM Monte Carlo (" << paths_simulated << " paths) vs Black:" << std::endl;
+	for (std::size_t i = 0; i < cap_prices.size(); i++)
+	{
+		std::cout << "Caplet " << i << ": " << cap_prices[i] << " +/- " << cap_errors[i] << " vs " << black_cap_prices[i]
+			<< "  Floorlet " << i << ": " << floor_prices[i] << " +/- " << floor_errors[i] << " vs " << black_floor_prices[i] << std::endl;
+	}
+	return;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include "Thread_Pool.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Libor_Market_Model.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Multi-threaded LIBOR Market Model Monte Carlo engine for caps, floors and path-dependent rate products.
+*
+* Forward i accrues over [t_i, t_i+1] of the zero rates, fixes at t_i and pays at t_i+1. The forwards are
+* lognormal with the caplet volatilities, correlated by exp(-decay |t_i - t_j|) (t in years), and simulated
+* under the spot LIBOR measure with predictor-corrector log-Euler steps between fixing dates.
+*/
+class Libor_Market_Model
+{
+private:
+	// Attributes: model
+	std::vector<double> forward_rates; // simple forwards (P_i / P_i+1 - 1) / tau_i
+	std::vector<double> accruals; // tau_i (years)
+	std::vector<double> volatilities;
+	std::vector<double> fixing_times; // t_i (days)
+	std::vector<double> payment_discounts; // P(0, t_i+1)
+	std::vector<double> correlations; // exp(-decay (t_i - t_i-1)) between neighbouring forwards
+	double first_discount{ 1 }; // P(0, t_0)
+	unsigned int steps_per_period{ 1 };
+
+	// Attributes: last optionlet pricing
+	std::vector<double> cap_prices;
+	std::vector<double> floor_prices;
+	std::vector<double> cap_errors; // standard errors
+	std::vector<double> floor_errors;
+	std::vector<double> black_cap_prices; // closed form on the same forwards and vols, for checking convergence
+	std::vector<double> black_floor_prices;
+	std::size_t paths_simulated{ 0 };
+
+	// Methods
+	void simulate_block(const std::uint64_t& seed, const std::uint64_t& first_path, const std::size_t& n_lanes, double* fixings, double* deflators, double* workspace) const;
+
+
+public:
+	// Constructors & Destructor
+	Libor_Market_Model(const std::vector<double>& vols, const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const double& correlation_decay = 0.1, const unsigned int& steps = 1);
+	~Libor_Market_Model() {};
+
+	// Simulation Methods
+	void price_optionlets(const std::vector<double>& strikes, const std::size_t& n_paths, const std::uint64_t& seed, Thread_Pool& pool = Thread_Pool::shared());
+	double price_path_dependent(const std::function<void(const double* fixings, double* cashflows)>& payoff, const std::size_t& n_paths, const std::uint64_t& seed, double& std_error, Thread_Pool& pool = Thread_Pool::shared());
+
+	// Layout of the simulation: paths are simulated in blocks of lanes (one array per forward, one entry per
+	// path of the block) and summed per chunk of paths, whose partial sums are added in chunk order
+	static const std::size_t lanes = 64;
+	static const std::size_t chunk_paths = 4096;
+
+	// Getter & Print Methods
+	std::size_t size() { return forward_rates.size(); };
+	const std::vector<double>& get_forward_rates() { return forward_rates; };
+	const std::vector<double>& get_cap_prices() { return cap_prices; };
+	const std::vector<double>& get_floor_prices() { return floor_prices; };
+	const std::vector<double>& get_cap_errors() { return cap_errors; };
+	const std::vector<double>& get_floor_errors() { return floor_errors; };
+	const std::vector<double>& get_black_cap_prices() { return black_cap_prices; };
+	const std::vector<double>& get_black_floor_prices() { return black_floor_prices; };
+	std::size_t get_paths_simulated() { return paths_simulated; };
+	void print_comparison();
+};
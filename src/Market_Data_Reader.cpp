@@ -0,0 +1,446 @@
+#include "Market_Data_Reader.h"
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+/**
+* Project:    Project 1
+* Filename:   Market_Data_Reader.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Memory-mapped reader streaming curve and optionlet quote records from CSV or binary files.
+*/
+
+
+namespace
+{
+	const char binary_magic[8] = { 'I', 'R', 'D', 'Q', 'B', 'I', 'N', '1' };
+	const std::size_t max_pillars = 100000; // guards the buffers against corrupt counts
+	const std::size_t release_interval = 64 * 1024 * 1024; // bytes read between hand-backs of consumed pages
+
+	/**
+	* Function to parse one comma separated numeric field starting at p, moving p past the separator.
+	*/
+	template<class T> bool parse_field(const char*& p, const char* end, T& value)
+	{
+		while (p < end && *p == ' ')
+		{
+			p++;
+		}
+		std::from_chars_result parsed = std::from_chars(p, end, value);
+		if (parsed.ec != std::errc() || parsed.ptr == p)
+		{
+			return false;
+		}
+		p = parsed.ptr;
+		while (p < end && *p == ' ')
+		{
+			p++;
+		}
+		if (p < end)
+		{
+			if (*p != ',')
+			{
+				return false;
+			}
+			p++;
+		}
+		return true;
+	}
+
+	/**
+	* Function to parse the quote type token (VOL, CAP or FLOOR) starting at p, moving p past the separator.
+	*/
+	bool parse_type(const char*& p, const char* end, Quote_Type& type)
+	{
+		while (p < end && *p == ' ')
+		{
+			p++;
+		}
+		const char* token = p;
+		while (p < end && *p != ',' && *p != ' ')
+		{
+			p++;
+		}
+		std::size_t length = p - token;
+		if (length == 3 && memcmp(token, "VOL", 3) == 0)
+		{
+			type = Quote_Volatility;
+		}
+		else if (length == 3 && memcmp(token, "CAP", 3) == 0)
+		{
+			type = Quote_Cap_Price;
+		}
+		else if (length == 5 && memcmp(token, "FLOOR", 5) == 0)
+		{
+			type = Quote_Floor_Price;
+		}
+		else {
+			return false;
+		}
+		while (p < end && *p == ' ')
+		{
+			p++;
+		}
+		if (p < end && *p == ',')
+		{
+			p++;
+			return true;
+		}
+		return false;
+	}
+}
+
+
+/**
+* Constructor that memory-maps a CSV or binary quote file (see Market_Data_Reader.h for the formats).
+* Nothing is read up front: records are parsed one at a time by next(), and pages already consumed
+* are periodically handed back to the OS, so files far larger than memory stream in bounded memory.
+* @param path const string reference, denotes the path of the file.
+*/
+Market_Data_Reader::Market_Data_Reader(const std::string& path)
+{
+#if defined(_WIN32)
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		throw 5; // File could not be opened.
+	}
+	LARGE_INTEGER length;
+	if (!GetFileSizeEx(file, &length))
+	{
+		CloseHandle(file);
+		throw 5;
+	}
+	file_handle = file;
+	file_size = std::size_t(length.QuadPart);
+	if (file_size > 0)
+	{
+		HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+		if (view == NULL)
+		{
+			if (mapping)
+			{
+				CloseHandle(mapping);
+			}
+			CloseHandle(file);
+			throw 5;
+		}
+		mapping_handle = mapping;
+		data = static_cast<const char*>(view);
+	}
+#else
+	file_descriptor = open(path.c_str(), O_RDONLY);
+	if (file_descriptor < 0)
+	{
+		throw 5; // File could not be opened.
+	}
+	struct stat info;
+	if (fstat(file_descriptor, &info) != 0)
+	{
+		close(file_descriptor);
+		throw 5;
+	}
+	file_size = std::size_t(info.st_size);
+	if (file_size > 0)
+	{
+		void* view = mmap(NULL, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+		if (view == MAP_FAILED)
+		{
+			close(file_descriptor);
+			throw 5;
+		}
+		madvise(view, file_size, MADV_SEQUENTIAL);
+		data = static_cast<const char*>(view);
+	}
+#endif
+
+	binary = file_size >= sizeof(binary_magic) && memcmp(data, binary_magic, sizeof(binary_magic)) == 0;
+	position = binary ? sizeof(binary_magic) : 0;
+}
+
+
+/**
+* Destructor that unmaps and closes the file.
+*/
+Market_Data_Reader::~Market_Data_Reader()
+{
+#if defined(_WIN32)
+	if (data)
+	{
+		UnmapViewOfFile(data);
+	}
+	if (mapping_handle)
+	{
+		CloseHandle(mapping_handle);
+	}
+	if (file_handle)
+	{
+		CloseHandle(file_handle);
+	}
+#else
+	if (data)
+	{
+		munmap(const_cast<char*>(data), file_size);
+	}
+	if (file_descriptor >= 0)
+	{
+		close(file_descriptor);
+	}
+#endif
+}
+
+
+/**
+* Function to read the next record. Malformed CSV lines are skipped and counted, a truncated or
+* corrupt binary record ends the stream. The arrays of the record point into buffers of the reader
+* that are reused (never shrunk), so steady state reading makes no allocations.
+* @param record Market_Record reference, filled with views of the record.
+* Returns false once the file is exhausted.
+*/
+bool Market_Data_Reader::next(Market_Record& record)
+{
+	bool found = binary ? next_binary(record) : next_csv(record);
+	if (found)
+	{
+		records_read++;
+		release_consumed();
+	}
+	return found;
+}
+
+
+/**
+* Function to restart reading from the first record.
+*/
+void Market_Data_Reader::rewind()
+{
+	position = binary ? sizeof(binary_magic) : 0;
+	released = 0;
+	records_read = 0;
+	records_rejected = 0;
+}
+
+
+/**
+* Function to read the next well formed line of a CSV file.
+*/
+bool Market_Data_Reader::next_csv(Market_Record& record)
+{
+	while (position < file_size)
+	{
+		const char* begin = data + position;
+		const char* newline = static_cast<const char*>(memchr(begin, '\n', file_size - position));
+		const char* end = newline ? newline : data + file_size;
+		position = (end - data) + (newline ? 1 : 0);
+
+		if (end > begin && end[-1] == '\r')
+		{
+			end--;
+		}
+		if (end == begin || *begin == '#')
+		{
+			continue; // blank line or comment
+		}
+		if (parse_csv_line(begin, end, record))
+		{
+			return true;
+		}
+		records_rejected++;
+	}
+	return false;
+}
+
+
+/**
+* Function to parse one CSV line into the buffers of the reader.
+* @param begin const char pointer, denotes the first character of the line.
+* @param end const char pointer, denotes one past the last character of the line.
+* @param record Market_Record reference, filled with views of the record.
+*/
+bool Market_Data_Reader::parse_csv_line(const char* begin, const char* end, Market_Record& record)
+{
+	const char* p = begin;
+	std::size_t n = 0;
+	if (!parse_field(p, end, record.date) || !parse_type(p, end, record.type) || !parse_field(p, end, n) || n < 2 || n > max_pillars)
+	{
+		return false;
+	}
+
+	if (rates.size() < n)
+	{
+		rates.resize(n);
+		times.resize(n);
+		strikes.resize(n);
+		quotes.resize(n);
+	}
+	for (std::size_t i = 0; i < n; i++)
+	{
+		if (!parse_field(p, end, rates[i]))
+		{
+			return false;
+		}
+	}
+	for (std::size_t i = 0; i < n; i++)
+	{
+		if (!parse_field(p, end, times[i]))
+		{
+			return false;
+		}
+	}
+	for (std::size_t i = 0; i + 1 < n; i++)
+	{
+		if (!parse_field(p, end, strikes[i]))
+		{
+			return false;
+		}
+	}
+	for (std::size_t i = 0; i + 1 < n; i++)
+	{
+		if (!parse_field(p, end, quotes[i]))
+		{
+			return false;
+		}
+	}
+	if (p != end)
+	{
+		return false; // trailing fields
+	}
+
+	record.n_pillars = n;
+	record.rates = rates.data();
+	record.times = times.data();
+	record.strikes = strikes.data();
+	record.quotes = quotes.data();
+	return true;
+}
+
+
+/**
+* Function to read the next record of a binary file.
+*/
+bool Market_Data_Reader::next_binary(Market_Record& record)
+{
+	if (position >= file_size)
+	{
+		return false;
+	}
+
+	std::uint32_t header[4];
+	if (file_size - position < sizeof(header))
+	{
+		records_rejected++;
+		position = file_size;
+		return false;
+	}
+	memcpy(header, data + position, sizeof(header));
+
+	std::size_t n = header[2];
+	std::size_t n_doubles = n + 2 * (n - 1);
+	std::size_t n_times = n + (n % 2);
+	if (n < 2 || n > max_pillars || header[1] > Quote_Floor_Price || file_size - position - sizeof(header) < n_doubles * sizeof(double) + n_times * sizeof(std::uint32_t))
+	{
+		records_rejected++; // corrupt or truncated, the following records cannot be located
+		position = file_size;
+		return false;
+	}
+
+	if (rates.size() < n)
+	{
+		rates.resize(n);
+		times.resize(n);
+		strikes.resize(n);
+		quotes.resize(n);
+	}
+	const char* p = data + position + sizeof(header);
+	memcpy(rates.data(), p, n * sizeof(double));
+	p += n * sizeof(double);
+	memcpy(strikes.data(), p, (n - 1) * sizeof(double));
+	p += (n - 1) * sizeof(double);
+	memcpy(quotes.data(), p, (n - 1) * sizeof(double));
+	p += (n - 1) * sizeof(double);
+	memcpy(times.data(), p, n * sizeof(std::uint32_t));
+	p += n_times * sizeof(std::uint32_t);
+	position = p - data;
+
+	record.date = header[0];
+	record.type = Quote_Type(header[1]);
+	record.n_pillars = n;
+	record.rates = rates.data();
+	record.times = times.data();
+	record.strikes = strikes.data();
+	record.quotes = quotes.data();
+	return true;
+}
+
+
+/**
+* Function to hand the pages already read back to the OS, keeping the resident size of the mapping bounded.
+*/
+void Market_Data_Reader::release_consumed()
+{
+	if (position - released < release_interval)
+	{
+		return;
+	}
+#if defined(_WIN32)
+	released = position; // the OS trims unused pages of a read-only view from the working set itself
+#else
+	std::size_t page = std::size_t(sysconf(_SC_PAGESIZE));
+	std::size_t end = (position / page) * page;
+	madvise(const_cast<char*>(data) + released, end - released, MADV_DONTNEED);
+	released = end;
+#endif
+}
+
+
+/**
+* Function to convert a CSV quote file into the binary format (see Market_Data_Reader.h), record by record.
+* Malformed CSV lines are dropped.
+* @param csv_path const string reference, denotes the path of the CSV file.
+* @param binary_path const string reference, denotes the path of the binary file to write.
+*/
+void Market_Data_Reader::write_binary(const std::string& csv_path, const std::string& binary_path)
+{
+	Market_Data_Reader reader(csv_path);
+	std::ofstream out(binary_path, std::ios::binary | std::ios::trunc);
+	if (!out)
+	{
+		throw 5;
+	}
+	out.write(binary_magic, sizeof(binary_magic));
+
+	Market_Record record;
+	std::vector<std::uint32_t> time_block;
+	while (reader.next(record))
+	{
+		std::size_t n = record.n_pillars;
+		std::uint32_t header[4] = { record.date, std::uint32_t(record.type), std::uint32_t(n), 0 };
+		out.write(reinterpret_cast<const char*>(header), sizeof(header));
+		out.write(reinterpret_cast<const char*>(record.rates), n * sizeof(double));
+		out.write(reinterpret_cast<const char*>(record.strikes), (n - 1) * sizeof(double));
+		out.write(reinterpret_cast<const char*>(record.quotes), (n - 1) * sizeof(double));
+		time_block.assign(record.times, record.times + n);
+		if (n % 2)
+		{
+			time_block.push_back(0);
+		}
+		out.write(reinterpret_cast<const char*>(time_block.data()), time_block.size() * sizeof(std::uint32_t));
+	}
+	if (!out)
+	{
+		throw 5;
+	}
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <string>
+
+
+/**
+* Project:    Project 1
+* Filename:   Market_Data_Reader.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Memory-mapped reader streaming curve and optionlet quote records from CSV or binary files.
+*
+* CSV format, one record per line (lines starting with '#' are skipped):
+*   date,type,n,r_1,...,r_n,t_1,...,t_n,k_1,...,k_n-1,q_1,...,q_n-1
+* where type is VOL (q are caplet volatilities), CAP or FLOOR (q are caplet or floorlet prices),
+* n is the number of curve pillars, r/t the zero rates and their times (days) and k the strikes.
+*
+* Binary format: the 8 byte magic "IRDQBIN1" followed by records of
+*   uint32 date, uint32 type, uint32 n, uint32 0, double r[n], double k[n-1], double q[n-1], uint32 t[n] (+ uint32 0 if n is odd)
+* in native byte order, so every record starts on an 8 byte boundary.
+*/
+
+enum Quote_Type
+{
+	Quote_Volatility = 0,
+	Quote_Cap_Price = 1,
+	Quote_Floor_Price = 2
+};
+
+struct Market_Record
+{
+	unsigned int date;
+	Quote_Type type;
+	std::size_t n_pillars; // n_pillars - 1 optionlets
+	const double* rates; // n_pillars entries
+	const unsigned int* times; // n_pillars entries
+	const double* strikes; // n_pillars - 1 entries
+	const double* quotes; // n_pillars - 1 entries
+};
+
+
+class Market_Data_Reader
+{
+private:
+	// Attributes
+	const char* data{ nullptr };
+	std::size_t file_size{ 0 };
+	std::size_t position{ 0 };
+	std::size_t released{ 0 }; // bytes already handed back to the OS
+	bool binary{ false };
+	std::size_t records_read{ 0 };
+	std::size_t records_rejected{ 0 };
+#if defined(_WIN32)
+	void* file_handle{ nullptr };
+	void* mapping_handle{ nullptr };
+#else
+	int file_descriptor{ -1 };
+#endif
+
+	// Buffers reused by every record, the record views point into them
+	std::vector<double> rates;
+	std::vector<unsigned int> times;
+	std::vector<double> strikes;
+	std::vector<double> quotes;
+
+	// Methods
+	bool next_csv(Market_Record& record);
+	bool next_binary(Market_Record& record);
+	bool parse_csv_line(const char* begin, const char* end, Market_Record& record);
+	void release_consumed();
+
+
+public:
+	// Constructor & Destructor
+	Market_Data_Reader(const std::string& path);
+	~Market_Data_Reader();
+	Market_Data_Reader(const Market_Data_Reader&) = delete;
+	Market_Data_Reader& operator=(const Market_Data_Reader&) = delete;
+
+	// Methods
+	bool next(Market_Record& record); // false once the file is exhausted, views valid until the next call
+	void rewind();
+	static void write_binary(const std::string& csv_path, const std::string& binary_path);
+
+	// Getter Methods
+	bool is_binary() { return binary; };
+	std::size_t get_records_read() { return records_read; };
+	std::size_t get_records_rejected() { return records_rejected; }; // malformed records skipped
+	std::size_t get_file_size() { return file_size; };
+};
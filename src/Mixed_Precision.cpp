@@ -0,0 +1,289 @@
+#include "Mixed_Precision.h"
+#include "Black_Simd.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+
+/**
+* Project:    Project 1
+* Filename:   Mixed_Precision.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Single precision batch pricing of caplets, floorlets and bond cashflows with double precision refinement.
+*/
+
+
+namespace
+{
+	const std::size_t block_size = 256; // optionlets repriced in double per kernel call
+	const int n_buckets = 256; // error bounds grouped by binary exponent, from 2^-128 to 2^127
+
+
+	/**
+	* Function to return the bucket of a non negative error bound from its binary exponent, the last one for
+	* infinite or NaN bounds.
+	* @param bound const double reference, denotes the error bound.
+	*/
+	inline int bound_bucket(const double& bound)
+	{
+		std::uint64_t bits;
+		std::memcpy(&bits, &bound, sizeof(bits));
+		int exponent = int((bits >> 52) & 0x7FF) - 1023; // 1024 for infinity and NaN
+		exponent = exponent < -128 ? -128 : (exponent > 127 ? 127 : exponent);
+		return exponent + 128;
+	}
+}
+
+
+/**
+* Function to round n doubles to float.
+* @param x const double pointer, denotes the values.
+* @param y float pointer, denotes the output array.
+* @param n const size_t reference, denotes the number of values.
+*/
+void Mixed_Precision::to_float(const double* x, float* y, const std::size_t& n)
+{
+	for (std::size_t i = 0; i < n; i++)
+	{
+		y[i] = float(x[i]);
+	}
+}
+
+
+/**
+* Function to return the bound on the error of a single precision optionlet price against the double kernels.
+* The same bound holds for caplets and floorlets.
+* @param strike const float reference, denotes the strike.
+* @param vol const float reference, denotes the volatility.
+* @param forward const float reference, denotes the forward rate.
+* @param t_1 const float reference, denotes the expiry (days).
+* @param discount const float reference, denotes the ZCB price at the end of the period.
+*/
+double Mixed_Precision::optionlet_error_bound(const float& strike, const float& vol, const float& forward, const float& t_1, const float& discount)
+{
+	double f = forward;
+	double k = strike;
+	double lower = f < k ? f : k; // |F - K| / min(F, K) bounds |log(F/K)|
+	double std_dev = vol * std::sqrt(t_1 * (1. / 365.));
+	return unit_roundoff * std::fabs(discount) * (4 * (f + k) + f * (4 * std::fabs(f - k) + 2 * lower) / (lower * std_dev) + 2 * f * std_dev);
+}
+
+
+/**
+* Function to return the bound on the error of a single precision discounted cashflow against the double path.
+* @param rate const float reference, denotes the zero rate at the payment date.
+* @param time const float reference, denotes the payment date (days).
+* @param value const float reference, denotes the single precision discounted cashflow.
+*/
+double Mixed_Precision::cashflow_error_bound(const float& rate, const float& time, const float& value)
+{
+	double x = std::fabs(double(rate) * time / 365.);
+	return unit_roundoff * std::fabs(double(value)) * (6 + 3 * x);
+}
+
+
+/**
+* Function to price a cap in single precision and sum its caplets in double.
+* @param strike const float pointer, denotes the strikes.
+* @param vol const float pointer, denotes the volatilities.
+* @param forward const float pointer, denotes the forward rates.
+* @param t_1 const float pointer, denotes the expiries (days).
+* @param discount const float pointer, denotes the ZCB prices at the end of each period.
+* @param n const size_t reference, denotes the number of caplets.
+* @param price float pointer, denotes the output array of caplet prices (refined ones rounded back to float).
+* @param tolerance const double reference, denotes the error allowed on the total (no refinement and no bound if not positive).
+*/
+Mixed_Total Mixed_Precision::cap_total(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, const std::size_t& n, float* price, const double& tolerance)
+{
+	return optionlet_total(strike, vol, forward, t_1, discount, n, true, price, tolerance);
+}
+
+
+/**
+* Function to price a floor in single precision and sum its floorlets in double. Parameters as for cap_total.
+*/
+Mixed_Total Mixed_Precision::floor_total(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, const std::size_t& n, float* price, const double& tolerance)
+{
+	return optionlet_total(strike, vol, forward, t_1, discount, n, false, price, tolerance);
+}
+
+
+/**
+* Function to price optionlets in single precision, then reprice in double, a block at a time, those with the
+* largest error bounds. The bounds are grouped by binary exponent and the largest groups are repriced until the
+* bounds left add up to at most the tolerance.
+* Parameters as for cap_total.
+*/
+Mixed_Total Mixed_Precision::optionlet_total(const float* strike, const float* vol, const float* forward, const float* t_1, const float* discount, const std::size_t& n, const bool& call, float* price, const double& tolerance)
+{
+	if (call)
+	{
+		Black_Simd::caplet_prices(strike, vol, forward, t_1, discount, price, n);
+	}
+	else {
+		Black_Simd::floorlet_prices(strike, vol, forward, t_1, discount, price, n);
+	}
+
+	Mixed_Total result;
+	if (!(tolerance > 0))
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			result.total += price[i];
+		}
+		result.error_bound = -1;
+		return result;
+	}
+
+	// Keep in single precision the items in the smallest buckets whose bounds add up to at most the tolerance
+	double bucket_sums[n_buckets] = {};
+	for (std::size_t i = 0; i < n; i++)
+	{
+		double bound = optionlet_error_bound(strike[i], vol[i], forward[i], t_1[i], discount[i]);
+		bucket_sums[bound_bucket(bound)] += bound;
+	}
+	int cut = 0;
+	for (double kept = 0; cut < n_buckets - 1 && kept + bucket_sums[cut] <= tolerance; cut++)
+	{
+		kept += bucket_sums[cut];
+	}
+
+	double block[6][block_size];
+	std::size_t index[block_size];
+	std::size_t n_block = 0;
+
+	for (std::size_t i = 0; i < n; i++)
+	{
+		double bound = optionlet_error_bound(strike[i], vol[i], forward[i], t_1[i], discount[i]);
+		if (bound_bucket(bound) >= cut)
+		{
+			index[n_block] = i;
+			block[0][n_block] = strike[i];
+			block[1][n_block] = vol[i];
+			block[2][n_block] = forward[i];
+			block[3][n_block] = t_1[i];
+			block[4][n_block] = discount[i];
+			n_block++;
+		}
+		else {
+			result.total += price[i];
+			result.error_bound += bound;
+		}
+
+		if (n_block == block_size || (i + 1 == n && n_block > 0))
+		{
+			if (call)
+			{
+				Black_Simd::caplet_prices(block[0], block[1], block[2], block[3], block[4], block[5], n_block);
+			}
+			else {
+				Black_Simd::floorlet_prices(block[0], block[1], block[2], block[3], block[4], block[5], n_block);
+			}
+			for (std::size_t j = 0; j < n_block; j++)
+			{
+				result.total += block[5][j];
+				price[index[j]] = float(block[5][j]);
+			}
+			result.refined += n_block;
+			n_block = 0;
+		}
+	}
+	return result;
+}
+
+
+/**
+* Function to discount n cashflows in single precision, values[i] = amounts[i] exp(-rates[i] times[i]/365).
+* @param amounts const float pointer, denotes the cashflows.
+* @param rates const float pointer, denotes the zero rate at each payment date.
+* @param times const float pointer, denotes the payment dates (days).
+* @param values float pointer, denotes the output array of discounted cashflows.
+* @param n const size_t reference, denotes the number of cashflows.
+*/
+void Mixed_Precision::cashflow_values(const float* amounts, const float* rates, const float* times, float* values, const std::size_t& n)
+{
+	for (std::size_t i = 0; i < n; i++)
+	{
+		values[i] = -1 * rates[i] * (times[i] / 365.f);
+	}
+	Black_Simd::exponentials(values, values, n);
+	for (std::size_t i = 0; i < n; i++)
+	{
+		values[i] *= amounts[i];
+	}
+}
+
+
+/**
+* Function to price bonds stored back to back in contiguous arrays (see Bond_Book.h) in single precision, each
+* price summed in double. When tolerance is positive and the bound of a price exceeds it, the cashflows of that
+* bond whose bound exceeds tolerance divided by their number are discounted in double as in Bond::get_price,
+* so every price is within tolerance of the double path.
+* @param amounts const float pointer, denotes the cashflows of every bond (principal included).
+* @param rates const float pointer, denotes the zero rate at each payment date.
+* @param times const float pointer, denotes the payment dates (days).
+* @param offsets const size_t pointer, denotes where the cashflows of each bond start (n_bonds + 1 entries).
+* @param n_bonds const size_t reference, denotes the number of bonds.
+* @param values float pointer, denotes the output array of discounted cashflows (indexed as amounts).
+* @param prices double pointer, denotes the output array of bond prices.
+* @param tolerance const double reference, denotes the error allowed on each price (no refinement and no bound if not positive).
+* The total returned is the sum of the prices and its bound the largest bound of a single price.
+*/
+Mixed_Total Mixed_Precision::bond_prices(const float* amounts, const float* rates, const float* times, const std::size_t* offsets, const std::size_t& n_bonds, float* values, double* prices, const double& tolerance)
+{
+	std::size_t first = offsets[0];
+	cashflow_values(amounts + first, rates + first, times + first, values + first, offsets[n_bonds] - first);
+
+	Mixed_Total result;
+	if (!(tolerance > 0))
+	{
+		for (std::size_t b = 0; b < n_bonds; b++)
+		{
+			double value = 0;
+			for (std::size_t c = offsets[b]; c < offsets[b + 1]; c++)
+			{
+				value += values[c];
+			}
+			prices[b] = value;
+			result.total += value;
+		}
+		result.error_bound = -1;
+		return result;
+	}
+
+	for (std::size_t b = 0; b < n_bonds; b++)
+	{
+		double bond_bound = 0;
+		for (std::size_t c = offsets[b]; c < offsets[b + 1]; c++)
+		{
+			bond_bound += cashflow_error_bound(rates[c], times[c], values[c]);
+		}
+		bool refine = !(bond_bound <= tolerance);
+		double threshold = tolerance / double(offsets[b + 1] - offsets[b]);
+
+		double value = 0;
+		double bound = 0;
+		for (std::size_t c = offsets[b]; c < offsets[b + 1]; c++)
+		{
+			double error = cashflow_error_bound(rates[c], times[c], values[c]);
+			if (refine && !(error <= threshold))
+			{
+				double t = times[c] / double(365);
+				value += amounts[c] * exp(-1 * rates[c] * t);
+				result.refined++;
+			}
+			else {
+				value += values[c];
+				bound += error;
+			}
+		}
+		prices[b] = value;
+		result.total += value;
+		if (bound > result.error_bound)
+		{
+			result.error_bound = bound;
+		}
+	}
+	return result;
+}
@@ -0,0 +1,388 @@
+#include "Optionlet_Batch.h"
+#include "Black_Simd.h"
+#include "Batch_Validation.h"
+#include "Compounding.h"
+#include <cmath>
+
+
+/**
+* Project:    Project 1
+* Filename:   Optionlet_Batch.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Structure-of-arrays batch engine for pricing caplets and floorlets.
+*/
+
+
+namespace
+{
+	/**
+	* Loop of Optionlet_Batch::pair_forwards for one compounding convention.
+	*/
+	template<class Compounding> void pair_periods(const double* rate_1, const unsigned int* t_1, const double* rate_2, const unsigned int* t_2, const std::size_t& n, const int& freq, const Input_Status* status, double* forward, double* expiry, double* discount)
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			if (status[i] != Input_Valid)
+			{
+				forward[i] = 1;
+				expiry[i] = 1;
+				discount[i] = 0;
+				continue;
+			}
+
+			double price_1 = zcb_price(rate_1[i], t_1[i]);
+			double price_2 = zcb_price(rate_2[i], t_2[i]);
+			forward[i] = Compounding::forward_rate(price_1, price_2, t_1[i], t_2[i], freq);
+			expiry[i] = t_1[i];
+			discount[i] = price_2;
+		}
+	}
+}
+
+
+/**
+* Constructor for a batch of optionlets (caplets or floorlets) written on consecutive
+* periods of the same set of zero rates. Each quantity is stored in its own contiguous
+* array, and the forward rates and discount factors are computed once per pillar.
+* @param strike_prices const vector double reference, denotes the strike (or exercise) prices of the options.
+* @param vols const vector double reference, denotes the interest rate volatilities.
+* @param rates const vector double reference, denotes the interest rates at each discrete time interval t_i.
+* @param time_of_rates const vector usigned int reference, denotes the times at which each of the rates occurs.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param freq const int reference, denotes the compounding frequency.
+* @param resource memory_resource pointer, denotes where the arrays of the batch are allocated.
+*/
+Optionlet_Batch::Optionlet_Batch(const std::vector<double>& strike_prices, const std::vector<double>& vols, const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const bool& continuous, const int& freq, std::pmr::memory_resource* resource)
+	: strikes(resource), volatilities(resource), forward_rates(resource), expiries(resource), discount_factors(resource)
+{
+	std::size_t n_options = strike_prices.size();
+
+	if (vols.size() != n_options || rates.size() != n_options + 1 || time_of_rates.size() != n_options + 1)
+	{
+		throw 3; // Check that for N options, N + 1 rates and times, as well as, N strikes and volatilities have been given.
+	}
+
+	for (std::size_t i = 0; i < n_options; i++)
+	{
+		if (strike_prices[i] < 0. || vols[i] < 0.)
+		{
+			throw 2; // Ensure all parameters take reasonable values.
+		}
+	}
+
+	strikes.assign(strike_prices.begin(), strike_prices.end());
+	volatilities.assign(vols.begin(), vols.end());
+	forward_rates.resize(n_options);
+	expiries.resize(n_options);
+	discount_factors.resize(n_options);
+
+	forward_curve(rates.data(), time_of_rates.data(), rates.size(), continuous, freq, forward_rates.data(), expiries.data(), discount_factors.data());
+}
+
+
+/**
+* Constructor for a batch of optionlets written on consecutive periods of a shared zero curve.
+* The forward rates, period starts and discount factors already computed by the curve are read
+* in place, so the batch neither recomputes nor copies them and the curve must outlive it.
+* @param strike_prices const vector double reference, denotes the strike (or exercise) prices of the options.
+* @param vols const vector double reference, denotes the interest rate volatilities.
+* @param curve const Discount_Curve reference, denotes the zero curve (one period per optionlet).
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param resource memory_resource pointer, denotes where the strikes and volatilities of the batch are allocated.
+*/
+Optionlet_Batch::Optionlet_Batch(const std::vector<double>& strike_prices, const std::vector<double>& vols, const Discount_Curve& curve, const bool& continuous, std::pmr::memory_resource* resource)
+	: strikes(resource), volatilities(resource), forward_rates(resource), expiries(resource), discount_factors(resource)
+{
+	std::size_t n_options = strike_prices.size();
+
+	if (vols.size() != n_options || curve.period_count() != n_options)
+	{
+		throw 3; // Check that for N options, a curve of N + 1 pillars, as well as, N strikes and volatilities have been given.
+	}
+
+	for (std::size_t i = 0; i < n_options; i++)
+	{
+		if (strike_prices[i] < 0. || vols[i] < 0.)
+		{
+			throw 2; // Ensure all parameters take reasonable values.
+		}
+	}
+	if (!continuous && Batch_Validation::validate_curve(curve.get_zero_rates().data(), curve.get_times().data(), curve.get_times().size(), curve.get_compounding_frequency(), false) == Input_Time_Order)
+	{
+		throw 1; // A discrete period shorter than one compounding period has no forward rate (as for the rates constructor).
+	}
+
+	strikes.assign(strike_prices.begin(), strike_prices.end());
+	volatilities.assign(vols.begin(), vols.end());
+	shared_curve = &curve;
+	continuous_compounding = continuous;
+}
+
+
+/**
+* Default constructor that sets up an empty batch.
+*/
+Optionlet_Batch::Optionlet_Batch()
+{
+}
+
+
+/**
+* Function to price every optionlet in the batch as a caplet.
+* @param prices vector double reference, resized and filled with the caplet prices.
+*/
+void Optionlet_Batch::price_caplets(std::pmr::vector<double>& prices)
+{
+	prices.resize(strikes.size());
+	caplet_prices(strikes.data(), volatilities.data(), get_forward_rates().data(), get_expiries().data(), get_discount_factors().data(), prices.data(), strikes.size());
+}
+
+
+/**
+* Function to price every optionlet in the batch as a floorlet.
+* @param prices vector double reference, resized and filled with the floorlet prices.
+*/
+void Optionlet_Batch::price_floorlets(std::pmr::vector<double>& prices)
+{
+	prices.resize(strikes.size());
+	floorlet_prices(strikes.data(), volatilities.data(), get_forward_rates().data(), get_expiries().data(), get_discount_factors().data(), prices.data(), strikes.size());
+}
+
+
+/**
+* Function to value every optionlet in the batch as a caplet, floorlet, digital caplet and digital floorlet in one pass.
+* @param cap vector double reference, resized and filled with the caplet prices.
+* @param floor vector double reference, resized and filled with the floorlet prices.
+* @param digital_cap vector double reference, resized and filled with the digital caplet prices.
+* @param digital_floor vector double reference, resized and filled with the digital floorlet prices.
+*/
+void Optionlet_Batch::value_optionlets(std::pmr::vector<double>& cap, std::pmr::vector<double>& floor, std::pmr::vector<double>& digital_cap, std::pmr::vector<double>& digital_floor)
+{
+	std::size_t n = strikes.size();
+	cap.resize(n);
+	floor.resize(n);
+	digital_cap.resize(n);
+	digital_floor.resize(n);
+	optionlet_values(strikes.data(), volatilities.data(), get_forward_rates().data(), get_expiries().data(), get_discount_factors().data(), cap.data(), floor.data(), digital_cap.data(), digital_floor.data(), n);
+}
+
+
+/**
+* Function to infer the volatility of every optionlet in the batch from its price (see Implied_Volatility.cpp).
+* The inferred volatilities replace those of the batch, failed inversions are flagged rather than thrown.
+* @param prices const vector double reference, denotes the fair price of each optionlet.
+* @param call const boolean reference, denotes whether the optionlets are caplets(true) or floorlets(false).
+* @param results vector Vol_Result reference, resized and filled with the outcome of each inversion.
+*/
+void Optionlet_Batch::imply_volatilities(const std::pmr::vector<double>& prices, const bool& call, std::pmr::vector<Vol_Result>& results)
+{
+	if (prices.size() != strikes.size())
+	{
+		throw 3;
+	}
+
+	const double* forward = get_forward_rates().data();
+	const double* expiry = get_expiries().data();
+	const double* discount = get_discount_factors().data();
+	results.resize(strikes.size());
+	for (std::size_t i = 0; i < strikes.size(); i++)
+	{
+		results[i] = Implied_Volatility::solve(prices[i], forward[i], strikes[i], expiry[i], discount[i], call);
+		volatilities[i] = results[i].volatility;
+	}
+}
+
+
+/**
+* Function to infer the volatility of every optionlet in the batch from its price, through a calibration
+* context that returns unchanged quotes from its cache and warm starts the others (see Vol_Calibration.cpp).
+* @param prices const vector double reference, denotes the fair price of each optionlet.
+* @param call const boolean reference, denotes whether the optionlets are caplets(true) or floorlets(false).
+* @param results vector Vol_Result reference, resized and filled with the outcome of each inversion.
+* @param calibration Vol_Calibration reference, denotes the context kept between successive ticks.
+*/
+void Optionlet_Batch::imply_volatilities(const std::pmr::vector<double>& prices, const bool& call, std::pmr::vector<Vol_Result>& results, Vol_Calibration& calibration)
+{
+	if (prices.size() != strikes.size())
+	{
+		throw 3;
+	}
+
+	results.resize(strikes.size());
+	calibration.solve_batch(prices.data(), get_forward_rates().data(), strikes.data(), get_expiries().data(), get_discount_factors().data(), strikes.size(), call, results.data());
+	for (std::size_t i = 0; i < strikes.size(); i++)
+	{
+		volatilities[i] = results[i].volatility;
+	}
+}
+
+
+/**
+* Function to replace the volatilities of the batch (e.g. once they have been inferred from prices).
+* @param vols const vector double reference, denotes the new volatilities (one per optionlet).
+*/
+void Optionlet_Batch::set_volatilities(const std::vector<double>& vols)
+{
+	if (vols.size() != strikes.size())
+	{
+		throw 3;
+	}
+	volatilities.assign(vols.begin(), vols.end());
+}
+
+
+/**
+* Kernel to price n caplets analytically (Black's formula, see Rate_Caplet.cpp).
+* All arrays are of length n and are read and written in a single pass, several
+* optionlets at a time on CPUs with vector units (see Black_Simd.h).
+* @param strike const double pointer, denotes the strike of each caplet.
+* @param vol const double pointer, denotes the volatility of each caplet.
+* @param forward const double pointer, denotes the forward rate of each caplet.
+* @param t_1 const double pointer, denotes the time (days) at which each caplet's rate is set.
+* @param discount const double pointer, denotes the ZCB price at the payment date of each caplet.
+* @param price double pointer, denotes the output array of caplet prices.
+* @param n const size_t reference, denotes the number of caplets.
+*/
+void Optionlet_Batch::caplet_prices(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n)
+{
+	Black_Simd::caplet_prices(strike, vol, forward, t_1, discount, price, n);
+}
+
+
+/**
+* Kernel to price n floorlets analytically (Black's formula, see Rate_Floorlet.cpp).
+* Parameters as for caplet_prices.
+*/
+void Optionlet_Batch::floorlet_prices(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n)
+{
+	Black_Simd::floorlet_prices(strike, vol, forward, t_1, discount, price, n);
+}
+
+
+/**
+* Kernel to value n optionlets as caplets, floorlets and digitals in one pass (see Black_Simd::optionlet_values).
+* d1 and d2 are shared, the floorlets and digital floorlets are priced from N(-d1) and N(-d2) directly.
+* Parameters as for caplet_prices, with one output array per value.
+*/
+void Optionlet_Batch::optionlet_values(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n)
+{
+	Black_Simd::optionlet_values(strike, vol, forward, t_1, discount, cap, floor, digital_cap, digital_floor, n);
+}
+
+
+/**
+* Kernel to price the caplets (or floorlets) written on consecutive periods of a zero curve straight from
+* caller-owned arrays into a caller-owned output array, with no heap allocation and no copy of the inputs.
+* The forwards are computed a block at a time into stack buffers, so each block is priced while in cache.
+* @param strike const double pointer, denotes the strike of each optionlet.
+* @param vol const double pointer, denotes the volatility of each optionlet.
+* @param rates const double pointer, denotes the zero rates at each pillar (n_options + 1).
+* @param time_of_rates const unsigned int pointer, denotes the time (days) of each pillar (n_options + 1).
+* @param n_options const size_t reference, denotes the number of optionlets.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param freq const int reference, denotes the compounding frequency.
+* @param call const boolean reference, denotes caplets (true) or floorlets (false).
+* @param price double pointer, denotes the output array of prices (length n_options).
+*/
+void Optionlet_Batch::curve_prices(const double* strike, const double* vol, const double* rates, const unsigned int* time_of_rates, const std::size_t& n_options, const bool& continuous, const int& freq, const bool& call, double* price)
+{
+	for (std::size_t i = 0; i < n_options; i++)
+	{
+		if (strike[i] < 0. || vol[i] < 0.)
+		{
+			throw 2; // Ensure all parameters take reasonable values.
+		}
+	}
+	Input_Status status = Batch_Validation::validate_curve(rates, time_of_rates, n_options + 1, freq, continuous);
+	if (status != Input_Valid)
+	{
+		throw int(status);
+	}
+
+	const std::size_t block = 256;
+	double forward[block];
+	double t_1[block];
+	double discount[block];
+	for (std::size_t begin = 0; begin < n_options; begin += block)
+	{
+		std::size_t n = n_options - begin < block ? n_options - begin : block;
+		forward_periods(rates + begin, time_of_rates + begin, n + 1, continuous, freq, forward, t_1, discount);
+		if (call)
+		{
+			Black_Simd::caplet_prices(strike + begin, vol + begin, forward, t_1, discount, price + begin, n);
+		}
+		else {
+			Black_Simd::floorlet_prices(strike + begin, vol + begin, forward, t_1, discount, price + begin, n);
+		}
+	}
+}
+
+
+/**
+* Kernel to compute, for each of the n_rates-1 periods of a set of zero rates, the forward rate,
+* the start of the period and the ZCB price at the end of the period. The whole curve is checked
+* once up front (see Batch_Validation.cpp) and the unchecked kernel forward_periods does the work.
+* @param rates const double pointer, denotes the zero rates at each pillar.
+* @param time_of_rates const unsigned int pointer, denotes the time (days) of each pillar.
+* @param n_rates const size_t reference, denotes the number of pillars.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param freq const int reference, denotes the compounding frequency.
+* @param forward double pointer, denotes the output array of forward rates (length n_rates-1).
+* @param t_1 double pointer, denotes the output array of period start times (length n_rates-1).
+* @param discount double pointer, denotes the output array of ZCB prices at period ends (length n_rates-1).
+*/
+void Optionlet_Batch::forward_curve(const double* rates, const unsigned int* time_of_rates, const std::size_t& n_rates, const bool& continuous, const int& freq, double* forward, double* t_1, double* discount)
+{
+	Input_Status status = Batch_Validation::validate_curve(rates, time_of_rates, n_rates, freq, continuous);
+	if (status != Input_Valid)
+	{
+		throw int(status); // 1: times not increasing (or a discrete period shorter than 365/freq days), 2: rates, times, and compounding frequency must be positive.
+	}
+	forward_periods(rates, time_of_rates, n_rates, continuous, freq, forward, t_1, discount);
+}
+
+
+/**
+* Kernel doing the work of forward_curve on a curve already validated, with no checks. Each pillar's
+* ZCB price is computed once and shared by the two periods it bounds (see Term_Structure.cpp for the formulae).
+* Parameters as for forward_curve.
+*/
+void Optionlet_Batch::forward_periods(const double* rates, const unsigned int* time_of_rates, const std::size_t& n_rates, const bool& continuous, const int& freq, double* forward, double* t_1, double* discount)
+{
+	if (continuous)
+	{
+		compounded_periods<Continuous_Compounding>(rates, time_of_rates, n_rates, freq, forward, t_1, discount);
+	}
+	else {
+		compounded_periods<Discrete_Compounding>(rates, time_of_rates, n_rates, freq, forward, t_1, discount);
+	}
+}
+
+
+/**
+* Kernel to compute the forward rate, start time and payment ZCB price of n optionlets each given by its own
+* pair of zero rates (as Term_Structure does one at a time), with no checks. Records whose status is not
+* Input_Valid are skipped and given placeholder values, so the pricing kernels can run over the whole array.
+* @param rate_1 const double pointer, denotes the zero rate at the start of each period.
+* @param t_1 const unsigned int pointer, denotes the start (days) of each period.
+* @param rate_2 const double pointer, denotes the zero rate at the end of each period.
+* @param t_2 const unsigned int pointer, denotes the end (days) of each period.
+* @param n const size_t reference, denotes the number of optionlets.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param freq const int reference, denotes the compounding frequency.
+* @param status const Input_Status pointer, denotes the outcome of validating each record.
+* @param forward double pointer, denotes the output array of forward rates.
+* @param expiry double pointer, denotes the output array of period start times.
+* @param discount double pointer, denotes the output array of ZCB prices at period ends.
+*/
+void Optionlet_Batch::pair_forwards(const double* rate_1, const unsigned int* t_1, const double* rate_2, const unsigned int* t_2, const std::size_t& n, const bool& continuous, const int& freq, const Input_Status* status, double* forward, double* expiry, double* discount)
+{
+	if (continuous)
+	{
+		pair_periods<Continuous_Compounding>(rate_1, t_1, rate_2, t_2, n, freq, status, forward, expiry, discount);
+	}
+	else {
+		pair_periods<Discrete_Compounding>(rate_1, t_1, rate_2, t_2, n, freq, status, forward, expiry, discount);
+	}
+}
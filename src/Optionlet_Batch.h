@@ -0,0 +1,65 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <memory_resource>
+#include "Implied_Volatility.h"
+#include "Vol_Calibration.h"
+#include "Discount_Curve.h"
+#include "Batch_Validation.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Optionlet_Batch.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Structure-of-arrays batch engine for pricing caplets and floorlets.
+*
+* The arrays are allocated from the memory resource given on construction (e.g. a Pricing_Workspace), the
+* default heap resource otherwise.
+*/
+class Optionlet_Batch
+{
+private:
+	// Attributes (one contiguous array per quantity, one entry per optionlet)
+	std::pmr::vector<double> strikes;
+	std::pmr::vector<double> volatilities;
+	std::pmr::vector<double> forward_rates; // empty when read from the curve
+	std::pmr::vector<double> expiries; // t_1 of each optionlet (days)
+	std::pmr::vector<double> discount_factors; // ZCB price at t_2 of each optionlet
+	const Discount_Curve* shared_curve{ nullptr }; // shared curve whose period arrays are read in place (must outlive the batch)
+	bool continuous_compounding{ false };
+
+
+public:
+	// Constructors & Destructor
+	Optionlet_Batch(const std::vector<double>& strike_prices, const std::vector<double>& vols, const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const bool& continuous, const int& freq = 4, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+	Optionlet_Batch(const std::vector<double>& strike_prices, const std::vector<double>& vols, const Discount_Curve& curve, const bool& continuous, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+	Optionlet_Batch();
+	~Optionlet_Batch() {};
+
+	// Batch Pricing Methods
+	void price_caplets(std::pmr::vector<double>& prices);
+	void price_floorlets(std::pmr::vector<double>& prices);
+	void value_optionlets(std::pmr::vector<double>& cap, std::pmr::vector<double>& floor, std::pmr::vector<double>& digital_cap, std::pmr::vector<double>& digital_floor);
+	void imply_volatilities(const std::pmr::vector<double>& prices, const bool& call, std::pmr::vector<Vol_Result>& results);
+	void imply_volatilities(const std::pmr::vector<double>& prices, const bool& call, std::pmr::vector<Vol_Result>& results, Vol_Calibration& calibration);
+
+	// Kernels operating on caller-owned contiguous arrays of length n
+	static void caplet_prices(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n);
+	static void floorlet_prices(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* price, const std::size_t& n);
+	static void optionlet_values(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n);
+	static void curve_prices(const double* strike, const double* vol, const double* rates, const unsigned int* time_of_rates, const std::size_t& n_options, const bool& continuous, const int& freq, const bool& call, double* price);
+	static void forward_curve(const double* rates, const unsigned int* time_of_rates, const std::size_t& n_rates, const bool& continuous, const int& freq, double* forward, double* t_1, double* discount);
+	static void forward_periods(const double* rates, const unsigned int* time_of_rates, const std::size_t& n_rates, const bool& continuous, const int& freq, double* forward, double* t_1, double* discount); // unchecked
+	static void pair_forwards(const double* rate_1, const unsigned int* t_1, const double* rate_2, const unsigned int* t_2, const std::size_t& n, const bool& continuous, const int& freq, const Input_Status* status, double* forward, double* expiry, double* discount); // unchecked
+
+	// Getter & Setter Methods
+	std::size_t size() { return strikes.size(); };
+	const std::pmr::vector<double>& get_strikes() { return strikes; };
+	const std::pmr::vector<double>& get_volatilities() { return volatilities; };
+	const std::pmr::vector<double>& get_forward_rates() { return shared_curve ? shared_curve->get_forward_rates(continuous_compounding) : forward_rates; };
+	const std::pmr::vector<double>& get_expiries() { return shared_curve ? shared_curve->get_period_starts() : expiries; };
+	const std::pmr::vector<double>& get_discount_factors() { return shared_curve ? shared_curve->get_period_discounts() : discount_factors; };
+	void set_volatilities(const std::vector<double>& vols);
+};
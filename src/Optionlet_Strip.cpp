@@ -0,0 +1,140 @@
+#include "Optionlet_Strip.h"
+#include <iostream>
+
+
+/**
+* Project:    Project 1
+* Filename:   Optionlet_Strip.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Strip of caplets or floorlets on consecutive periods, the engine behind Rate_Cap and Rate_Floor.
+*/
+
+
+/**
+* Constructor for a strip of caplets or floorlets, each with a fair price, volatility and strike
+* price as well as some other dependencies (see Rate_Caplet.cpp and Rate_Floorlet.cpp).
+* @param strikes const vector double reference, denotes the strike (or exercise) prices of the options.
+* @param volatilities const vector double reference, denotes the interest rate volatilities.
+* @param rates const vector double reference, denotes the interest rates at each discrete time interval t_i.
+* @param time_of_rates const vector usigned int reference, denotes the times at which each of the rates occurs.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param call const boolean reference, denotes whether the optionlets are caplets(true) or floorlets(false).
+* @param resource memory_resource pointer, denotes where the arrays of the strip are allocated.
+*/
+Optionlet_Strip::Optionlet_Strip(const std::vector<double>& strikes, const std::vector<double>& volatilities, const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const bool& continuous, const bool& call, std::pmr::memory_resource* resource)
+	: optionlet_batch(strikes, volatilities, rates, time_of_rates, continuous, 4, resource), optionlet_prices(resource), optionlet_vol_results(resource) // Checks that for N options, N+1 rates and times, as well as, N strikes and volatilities have been given.
+{
+	call_option = call;
+	continuous_compounding = continuous;
+	if (call_option)
+	{
+		optionlet_batch.price_caplets(optionlet_prices);
+	}
+	else {
+		optionlet_batch.price_floorlets(optionlet_prices);
+	}
+}
+
+
+/**
+* Constructor for a strip of caplets or floorlets from the price of each optionlet, inferring the
+* corresponding volatilities (see Implied_Volatility.cpp).
+* @param strikes const vector double reference, denotes the strike (or exercise) prices of the options.
+* @param prices const vector double reference, denotes the price of each optionlet.
+* @param time_of_rates const vector usigned int reference, denotes the times at which each of the rates occurs.
+* @param rates const vector double reference, denotes the interest rates at each discrete time interval t_i.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param call const boolean reference, denotes whether the optionlets are caplets(true) or floorlets(false).
+* @param resource memory_resource pointer, denotes where the arrays of the strip are allocated.
+*/
+Optionlet_Strip::Optionlet_Strip(const std::vector<double>& strikes, const std::vector<double>& prices, const std::vector<unsigned int>& time_of_rates, const std::vector<double>& rates, const bool& continuous, const bool& call, std::pmr::memory_resource* resource)
+	: optionlet_batch(strikes, strikes, rates, time_of_rates, continuous, 4, resource), optionlet_prices(resource), optionlet_vol_results(resource) //placeholder vols (any non-negative array) replaced by the inferred ones
+{
+	if (prices.size() != strikes.size())
+	{
+		throw 3; // Check that for N options, N + 1 rates and times, as well as, N strikes and prices have been given.
+	}
+
+	call_option = call;
+	continuous_compounding = continuous;
+	optionlet_prices.assign(prices.begin(), prices.end());
+
+	// Infer the volatility of each optionlet from its price, failed inversions give NaN volatilities.
+	optionlet_batch.imply_volatilities(optionlet_prices, call_option, optionlet_vol_results);
+	for (auto &r : optionlet_vol_results)
+	{
+		Implied_Volatility::print_warning(r);
+	}
+}
+
+
+/**
+* Constructor for a strip priced off a shared zero curve, with one optionlet per period of the
+* curve. The curve is only read, so any number of caps, floors and bonds can price off one curve
+* without recomputing or copying its discount factors or forward rates (it must outlive the object).
+* @param strikes const vector double reference, denotes the strike (or exercise) prices of the options.
+* @param volatilities const vector double reference, denotes the interest rate volatilities.
+* @param curve const Discount_Curve reference, denotes the zero curve (N+1 pillars for N optionlets).
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param call const boolean reference, denotes whether the optionlets are caplets(true) or floorlets(false).
+* @param resource memory_resource pointer, denotes where the arrays of the strip are allocated.
+*/
+Optionlet_Strip::Optionlet_Strip(const std::vector<double>& strikes, const std::vector<double>& volatilities, const Discount_Curve& curve, const bool& continuous, const bool& call, std::pmr::memory_resource* resource)
+	: optionlet_batch(strikes, volatilities, curve, continuous, resource), optionlet_prices(resource), optionlet_vol_results(resource)
+{
+	call_option = call;
+	continuous_compounding = continuous;
+	if (call_option)
+	{
+		optionlet_batch.price_caplets(optionlet_prices);
+	}
+	else {
+		optionlet_batch.price_floorlets(optionlet_prices);
+	}
+}
+
+
+/**
+* Function to print the fair prices of the optionlets to the console.
+*/
+void Optionlet_Strip::print_prices()
+{
+	std::cout << (call_option ? "Cap Prices: " : "Floor Prices: ");
+	for (auto &p : optionlet_prices)
+	{
+		std::cout << p << " ";
+	}
+	std::cout << std::endl;
+	return;
+}
+
+
+/**
+* Function to print the inferred volatilities to the console.
+*/
+void Optionlet_Strip::print_volatilities()
+{
+	std::cout << (call_option ? "Cap Volatilities: " : "Floor Volatilities: ");
+	for (auto &p : optionlet_batch.get_volatilities())
+	{
+		std::cout << p << " ";
+	}
+	std::cout << std::endl;
+	return;
+}
+
+
+/**
+* Function to print the forward rates to the console.
+*/
+void Optionlet_Strip::print_forward_rate()
+{
+	std::cout << "Forward Rates: ";
+	for (auto &p : optionlet_batch.get_forward_rates())
+	{
+		std::cout << p << " ";
+	}
+	std::cout << std::endl;
+	return;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <memory_resource>
+#include "Optionlet_Batch.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Optionlet_Strip.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Strip of caplets or floorlets on consecutive periods, the engine behind Rate_Cap and Rate_Floor.
+*
+* Every array of the strip is allocated from the memory resource given on construction (e.g. a Pricing_Workspace),
+* the default heap resource otherwise.
+*/
+class Optionlet_Strip
+{
+private:
+	// Attributes
+	Optionlet_Batch optionlet_batch; //Strikes, volatilities, forward rates and discount factors of the optionlets
+	bool call_option{ true }; // caplets(true) or floorlets(false)
+	bool continuous_compounding{ false };
+	std::pmr::vector<double> optionlet_prices;
+	std::pmr::vector<Vol_Result> optionlet_vol_results; //Outcome of each volatility inversion (price constructor only)
+
+
+public:
+	// Constructors & Destructor
+	Optionlet_Strip(const std::vector<double>& strikes, const std::vector<double>& volatilities, const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const bool& continuous, const bool& call, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+	Optionlet_Strip(const std::vector<double>& strikes, const std::vector<double>& prices, const std::vector<unsigned int>& time_of_rates, const std::vector<double>& rates, const bool& continuous, const bool& call, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+	Optionlet_Strip(const std::vector<double>& strikes, const std::vector<double>& volatilities, const Discount_Curve& curve, const bool& continuous, const bool& call, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+	~Optionlet_Strip() {};
+
+	// Getter & Print Methods
+	bool is_call() { return call_option; };
+	const std::pmr::vector<double>& get_prices() { return optionlet_prices; };
+	const std::pmr::vector<double>& get_volatilities() { return optionlet_batch.get_volatilities(); };
+	const std::pmr::vector<Vol_Result>& get_volatility_results() { return optionlet_vol_results; };
+	void print_prices();
+	void print_volatilities();
+	void print_forward_rate();
+};
@@ -0,0 +1,181 @@
+#include "Pricing_Workspace.h"
+#include "Batch_Validation.h"
+#include "Compounding.h"
+#include "Rate_Cap.h"
+#include "Rate_Floor.h"
+#include <cstdint>
+
+
+/**
+* Project:    Project 1
+* Filename:   Pricing_Workspace.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Monotonic arena that the objects of a pricing scenario allocate from, reset in O(1) between scenarios.
+*/
+
+
+/**
+* Constructor for a workspace with one block of the given size.
+* @param initial_bytes const size_t reference, denotes the size of the first block.
+*/
+Pricing_Workspace::Pricing_Workspace(const std::size_t& initial_bytes)
+{
+	blocks.reserve(16);
+	add_block(initial_bytes > 64 ? initial_bytes : 64);
+}
+
+
+/**
+* Function to release everything allocated since the last reset. With a single block this only rewinds the
+* bump pointer; otherwise the blocks are replaced by one holding the whole scenario (a single heap allocation).
+*/
+void Pricing_Workspace::reset()
+{
+	if (blocks.size() > 1)
+	{
+		std::size_t total = 0;
+		for (auto &b : blocks)
+		{
+			total += b.size;
+		}
+		blocks.clear();
+		add_block(total);
+	}
+	offset = 0;
+	bytes_in_use = 0;
+	allocations = 0;
+	resets++;
+}
+
+
+/**
+* Function to take a new block from the heap, at least double the size of the last one.
+* @param min_bytes const size_t reference, denotes the size needed.
+*/
+void Pricing_Workspace::add_block(const std::size_t& min_bytes)
+{
+	std::size_t size = blocks.empty() ? min_bytes : 2 * blocks.back().size;
+	if (size < min_bytes)
+	{
+		size = min_bytes;
+	}
+	blocks.push_back(Block{ std::unique_ptr<unsigned char[]>(new unsigned char[size]), size });
+	offset = 0;
+	heap_allocations++;
+}
+
+
+/**
+* Function to serve an allocation from the current block, moving to a new block if it does not fit.
+* @param bytes size_t, denotes the size of the allocation.
+* @param alignment size_t, denotes the alignment required (a power of two).
+*/
+void* Pricing_Workspace::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+	std::uintptr_t base = reinterpret_cast<std::uintptr_t>(blocks.back().memory.get());
+	std::size_t start = ((base + offset + alignment - 1) & ~std::uintptr_t(alignment - 1)) - base;
+	if (start + bytes > blocks.back().size)
+	{
+		bytes_in_use += blocks.back().size - offset; // the rest of the block is lost until reset
+		add_block(bytes + alignment);
+		base = reinterpret_cast<std::uintptr_t>(blocks.back().memory.get());
+		start = ((base + alignment - 1) & ~std::uintptr_t(alignment - 1)) - base;
+	}
+	bytes_in_use += start + bytes - offset;
+	offset = start + bytes;
+	if (bytes_in_use > peak_bytes)
+	{
+		peak_bytes = bytes_in_use;
+	}
+	allocations++;
+	total_allocations++;
+	return blocks.back().memory.get() + start;
+}
+
+
+/**
+* Function to price a cap on consecutive periods of the zero rates into the workspace (see Rate_Cap::price).
+* @param strikes const double pointer, denotes the strike (or exercise) prices of the options.
+* @param volatilities const double pointer, denotes the interest rate volatilities.
+* @param rates const double pointer, denotes the interest rates at each pillar (n_caplets + 1).
+* @param time_of_rates const unsigned int pointer, denotes the times (days) of each pillar (n_caplets + 1).
+* @param n_caplets const size_t reference, denotes the number of caplets.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param freq const int reference, denotes the compounding frequency.
+* Returns the caplet prices (n_caplets).
+*/
+double* Pricing_Workspace::price_cap(const double* strikes, const double* volatilities, const double* rates, const unsigned int* time_of_rates, const std::size_t& n_caplets, const bool& continuous, const int& freq)
+{
+	double* prices = allocate_array<double>(n_caplets);
+	Rate_Cap::price(strikes, volatilities, rates, time_of_rates, n_caplets, continuous, prices, freq);
+	return prices;
+}
+
+
+/**
+* Function to price a floor on consecutive periods of the zero rates into the workspace (see Rate_Floor::price).
+* Parameters as for price_cap. Returns the floorlet prices (n_floorlets).
+*/
+double* Pricing_Workspace::price_floor(const double* strikes, const double* volatilities, const double* rates, const unsigned int* time_of_rates, const std::size_t& n_floorlets, const bool& continuous, const int& freq)
+{
+	double* prices = allocate_array<double>(n_floorlets);
+	Rate_Floor::price(strikes, volatilities, rates, time_of_rates, n_floorlets, continuous, prices, freq);
+	return prices;
+}
+
+
+/**
+* Function to compute the term structure of forward rates between consecutive pillars into the workspace,
+* checking the curve as Optionlet_Batch::forward_curve does but computing only the forwards.
+* @param rates const double pointer, denotes the zero rates at each pillar.
+* @param time_of_rates const unsigned int pointer, denotes the time (days) of each pillar.
+* @param n_rates const size_t reference, denotes the number of pillars.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param freq const int reference, denotes the compounding frequency.
+* Returns the forward rate of each period (n_rates - 1).
+*/
+double* Pricing_Workspace::forward_rates(const double* rates, const unsigned int* time_of_rates, const std::size_t& n_rates, const bool& continuous, const int& freq)
+{
+	Input_Status status = Batch_Validation::validate_curve(rates, time_of_rates, n_rates, freq, continuous);
+	if (status != Input_Valid)
+	{
+		throw int(status);
+	}
+
+	std::size_t n_periods = n_rates > 0 ? n_rates - 1 : 0;
+	double* forward = allocate_array<double>(n_periods);
+	if (continuous)
+	{
+		compounded_forwards<Continuous_Compounding>(rates, time_of_rates, n_rates, freq, forward);
+	}
+	else {
+		compounded_forwards<Discrete_Compounding>(rates, time_of_rates, n_rates, freq, forward);
+	}
+	return forward;
+}
+
+
+/**
+* Function to price bonds stored back to back in contiguous arrays (see Bond_Book.h) off a zero curve into the workspace.
+* @param amounts const double pointer, denotes the cashflows of every bond (principal included).
+* @param times const double pointer, denotes the time (days) of every cashflow.
+* @param offsets const size_t pointer, denotes where the cashflows of each bond start (n_bonds + 1 entries).
+* @param n_bonds const size_t reference, denotes the number of bonds.
+* @param curve const Discount_Curve reference, denotes the zero curve.
+* Returns the price of each bond (n_bonds).
+*/
+double* Pricing_Workspace::price_bonds(const double* amounts, const double* times, const std::size_t* offsets, const std::size_t& n_bonds, const Discount_Curve& curve)
+{
+	double* prices = allocate_array<double>(n_bonds);
+	for (std::size_t b = 0; b < n_bonds; b++)
+	{
+		double value = 0;
+		for (std::size_t c = offsets[b]; c < offsets[b + 1]; c++)
+		{
+			value += amounts[c] * curve.get_discount_factor(times[c]);
+		}
+		prices[b] = value;
+	}
+	return prices;
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include "Discount_Curve.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Pricing_Workspace.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Monotonic arena that the objects of a pricing scenario allocate from, reset in O(1) between scenarios.
+*
+* Allocations bump a pointer through blocks taken from the heap; nothing is freed until reset. When a scenario
+* needed more than one block, reset replaces them with a single block large enough for the whole scenario, so
+* once the largest scenario has run every later one is served from that block with no heap allocation.
+* The workspace is also a std::pmr::memory_resource: Rate_Cap, Rate_Floor, Rate_Cap_Floor, Optionlet_Batch,
+* Discount_Curve and Bond_Book take it as their last constructor argument and then allocate every array from it.
+* Results returned by the pricing methods, and objects built on the workspace, are invalidated by reset
+* (destroy the objects first; their deallocations are no-ops).
+*/
+class Pricing_Workspace : public std::pmr::memory_resource
+{
+private:
+	struct Block
+	{
+		std::unique_ptr<unsigned char[]> memory;
+		std::size_t size;
+	};
+
+	// Attributes
+	std::vector<Block> blocks;
+	std::size_t offset{ 0 }; // bytes used in the last block
+	std::size_t bytes_in_use{ 0 }; // since the last reset, padding included
+	std::size_t peak_bytes{ 0 };
+	std::size_t heap_allocations{ 0 }; // blocks taken from the heap since construction
+	std::size_t allocations{ 0 }; // served since the last reset
+	std::size_t total_allocations{ 0 }; // served since construction
+	std::size_t resets{ 0 };
+
+	// Methods
+	void add_block(const std::size_t& min_bytes);
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+	void do_deallocate(void*, std::size_t, std::size_t) override {}; // monotonic, memory comes back on reset
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; };
+
+
+public:
+	// Constructors & Destructor
+	Pricing_Workspace(const std::size_t& initial_bytes = 1 << 16);
+	~Pricing_Workspace() {};
+	Pricing_Workspace(const Pricing_Workspace&) = delete;
+	Pricing_Workspace& operator=(const Pricing_Workspace&) = delete;
+
+	// Arena Methods
+	void reset();
+	template<class T> T* allocate_array(const std::size_t& n) { return static_cast<T*>(allocate(n * sizeof(T), alignof(T))); };
+
+	// Pricing Methods (inputs are read in place, outputs are allocated in the workspace)
+	double* price_cap(const double* strikes, const double* volatilities, const double* rates, const unsigned int* time_of_rates, const std::size_t& n_caplets, const bool& continuous, const int& freq = 4);
+	double* price_floor(const double* strikes, const double* volatilities, const double* rates, const unsigned int* time_of_rates, const std::size_t& n_floorlets, const bool& continuous, const int& freq = 4);
+	double* forward_rates(const double* rates, const unsigned int* time_of_rates, const std::size_t& n_rates, const bool& continuous, const int& freq = 4);
+	double* price_bonds(const double* amounts, const double* times, const std::size_t* offsets, const std::size_t& n_bonds, const Discount_Curve& curve);
+
+	// Getter Methods (counters)
+	std::size_t get_heap_allocations() { return heap_allocations; };
+	std::size_t get_allocations() { return allocations; };
+	std::size_t get_total_allocations() { return total_allocations; };
+	std::size_t get_bytes_in_use() { return bytes_in_use; };
+	std::size_t get_peak_bytes() { return peak_bytes; };
+	std::size_t get_capacity() { return blocks.empty() ? 0 : blocks.back().size; }; // block currently served from
+	std::size_t get_block_count() { return blocks.size(); };
+	std::size_t get_resets() { return resets; };
+};
@@ -0,0 +1,80 @@
+#include "Quote_Stream.h"
+#include "Optionlet_Batch.h"
+#include "Batch_Validation.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Quote_Stream.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Streams quote records from a Market_Data_Reader through the cap/floor pricer and the implied volatility solver.
+*/
+
+
+/**
+* Function to read every remaining record of the reader and hand it, priced, to a callback. VOL records are
+* priced as caps and floors in one pass (see Optionlet_Batch::optionlet_values), CAP and FLOOR records have
+* the volatility of each optionlet implied from its price, warm started from the volatility implied for the same
+* strike and expiry on a previous record (see Vol_Calibration.cpp). Only one record is
+* held at a time, every buffer is reused and the volatility cache holds at most Vol_Calibration::default_capacity
+* optionlets, so memory stays bounded whatever the size of the file.
+* A record whose curve is unusable (e.g. non-increasing times) is skipped and counted, no exception is raised.
+* @param reader Market_Data_Reader reference, denotes the source of the records.
+* @param on_record const function reference, called with each record and its results (valid until it returns).
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* Returns the number of records priced.
+*/
+std::size_t Quote_Stream::run(Market_Data_Reader& reader, const std::function<void(const Market_Record& record, const Stream_Result& result)>& on_record, const bool& continuous)
+{
+	std::size_t priced = 0;
+	Market_Record record;
+	while (reader.next(record))
+	{
+		std::size_t n = record.n_pillars - 1;
+		if (forward_rates.size() < n)
+		{
+			forward_rates.resize(n);
+			expiries.resize(n);
+			discount_factors.resize(n);
+			cap_prices.resize(n);
+			floor_prices.resize(n);
+			digital_caps.resize(n);
+			digital_floors.resize(n);
+			volatilities.resize(n);
+			vol_results.resize(n);
+		}
+
+		if (Batch_Validation::validate_curve(record.rates, record.times, record.n_pillars, 4, continuous) != Input_Valid)
+		{
+			records_failed++;
+			continue;
+		}
+		Optionlet_Batch::forward_periods(record.rates, record.times, record.n_pillars, continuous, 4, forward_rates.data(), expiries.data(), discount_factors.data());
+
+		Stream_Result result{ n, forward_rates.data(), nullptr, nullptr, nullptr, nullptr };
+		if (record.type == Quote_Volatility)
+		{
+			Optionlet_Batch::optionlet_values(record.strikes, record.quotes, forward_rates.data(), expiries.data(), discount_factors.data(), cap_prices.data(), floor_prices.data(), digital_caps.data(), digital_floors.data(), n);
+			result.volatilities = record.quotes;
+			result.cap_prices = cap_prices.data();
+			result.floor_prices = floor_prices.data();
+		}
+		else {
+			bool call = record.type == Quote_Cap_Price;
+			calibration.solve_batch(record.quotes, forward_rates.data(), record.strikes, expiries.data(), discount_factors.data(), n, call, vol_results.data());
+			for (std::size_t i = 0; i < n; i++)
+			{
+				volatilities[i] = vol_results[i].volatility;
+			}
+			result.volatilities = volatilities.data();
+			result.vol_results = vol_results.data();
+			(call ? result.cap_prices : result.floor_prices) = record.quotes;
+		}
+
+		on_record(record, result);
+		priced++;
+		records_priced++;
+	}
+	return priced;
+}
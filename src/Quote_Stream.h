@@ -0,0 +1,58 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <functional>
+#include "Market_Data_Reader.h"
+#include "Vol_Calibration.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Quote_Stream.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Streams quote records from a Market_Data_Reader through the cap/floor pricer and the implied volatility solver.
+*/
+
+struct Stream_Result
+{
+	std::size_t n_optionlets;
+	const double* forward_rates;
+	const double* volatilities; // quoted (VOL records) or implied (CAP/FLOOR records)
+	const double* cap_prices; // priced (VOL records) or quoted (CAP records), nullptr for FLOOR records
+	const double* floor_prices; // priced (VOL records) or quoted (FLOOR records), nullptr for CAP records
+	const Vol_Result* vol_results; // outcome of each inversion, nullptr for VOL records
+};
+
+
+class Quote_Stream
+{
+private:
+	// Buffers reused by every record (sized to the largest record seen)
+	std::vector<double> forward_rates;
+	std::vector<double> expiries;
+	std::vector<double> discount_factors;
+	std::vector<double> cap_prices;
+	std::vector<double> floor_prices;
+	std::vector<double> digital_caps;
+	std::vector<double> digital_floors;
+	std::vector<double> volatilities;
+	std::vector<Vol_Result> vol_results;
+	Vol_Calibration calibration; // implied vols of the previous records, keyed by (strike, expiry)
+	std::size_t records_priced{ 0 };
+	std::size_t records_failed{ 0 };
+
+
+public:
+	// Constructor & Destructor
+	Quote_Stream() {};
+	~Quote_Stream() {};
+
+	// Methods
+	std::size_t run(Market_Data_Reader& reader, const std::function<void(const Market_Record& record, const Stream_Result& result)>& on_record, const bool& continuous = true);
+
+	// Getter Methods
+	std::size_t get_records_priced() { return records_priced; };
+	std::size_t get_records_failed() { return records_failed; }; // records with an unusable curve
+	Vol_Calibration& get_calibration() { return calibration; };
+};
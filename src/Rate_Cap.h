@@ -1,5 +1,6 @@
 #pragma once
 #include "Rate_Caplet.h"
+#include "Optionlet_Strip.h"
 
 
 /**
@@ -7,33 +8,17 @@
 * Filename:   Rate_Cap.h
 * Version:    v1 (9 March 2020)
 * Author:     Ryan Sephton
-* Summary:   Class to store several rate caplets.
+* Summary:    Class to store several rate caplets.
 */
-class Rate_Cap
+class Rate_Cap : public Optionlet_Strip
 {
-private:
-	// Attributes
-	std::vector<Rate_Caplet> caplets; //Caplets that comprise the cap
-	bool continuous_compounding{ false };
-	std::vector<double> caplet_prices;
-	std::vector<double> caplet_forward_rates;
-	std::vector<double> interest_rates;
-	std::vector<unsigned int> maturities;
-	std::vector<double> caplet_volatilities;
-	std::vector<double> caplet_strikes;
-
-
 public:
-	// Constructor & Destructor
-	Rate_Cap(const std::vector<double>& strikes, const std::vector<double>& volatilities, const std::vector<double>& rates, std::vector<unsigned int>& time_of_rates, const bool& continuous);
-	Rate_Cap(const std::vector<double>& strikes, const std::vector<double>& prices, std::vector<unsigned int>& time_of_rates, const std::vector<double>& rates, const bool& continuous);
+	// Constructor & Destructor (see Optionlet_Strip.h for the getters and print methods)
+	Rate_Cap(const std::vector<double>& strikes, const std::vector<double>& volatilities, const std::vector<double>& rates, std::vector<unsigned int>& time_of_rates, const bool& continuous, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+	Rate_Cap(const std::vector<double>& strikes, const std::vector<double>& prices, std::vector<unsigned int>& time_of_rates, const std::vector<double>& rates, const bool& continuous, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+	Rate_Cap(const std::vector<double>& strikes, const std::vector<double>& volatilities, const Discount_Curve& curve, const bool& continuous, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 	~Rate_Cap() {};
 
-	// Getter & Print Methods
-	std::vector<double> get_prices() { return caplet_prices; };
-	std::vector<double> get_volatilities() { return caplet_volatilities; };
-	void print_prices();
-	void print_volatilities();
-	void print_forward_rate();
+	// Pricing from caller-owned arrays (no allocation, no copies)
+	static void price(const double* strikes, const double* volatilities, const double* rates, const unsigned int* time_of_rates, const std::size_t& n_caplets, const bool& continuous, double* prices, const int& freq = 4);
 };
-
@@ -0,0 +1,115 @@
+#include "Rate_Cap_Floor.h"
+#include <iostream>
+
+
+/**
+* Project:    Project 1
+* Filename:   Rate_Cap_Floor.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Class to price a cap, floor, collar and digital cap/floor on the same optionlets in one pass.
+*/
+
+
+/**
+* Constructor for a cap and a floor with the same strikes and volatilities, priced together.
+* The forward rates and d1/d2 are computed once per optionlet, the floorlets are priced from the
+* same d1/d2 and the collar (long cap, short floor) is their difference (see Black_Simd.cpp).
+* @param strikes const vector double reference, denotes the strike (or exercise) prices of the options.
+* @param volatilities const vector double reference, denotes the interest rate volatilities.
+* @param rates const vector double reference, denotes the interest rates at each discrete time interval t_i.
+* @param time_of_rates const vector usigned int reference, denotes the times at which each of the rates occurs.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param resource memory_resource pointer, denotes where the arrays of the object are allocated.
+*/
+Rate_Cap_Floor::Rate_Cap_Floor(const std::vector<double>& strikes, const std::vector<double>& volatilities, const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const bool& continuous, std::pmr::memory_resource* resource)
+	: optionlet_batch(strikes, volatilities, rates, time_of_rates, continuous, 4, resource), caplet_prices(resource), floorlet_prices(resource), collar_prices(resource), digital_caplet_prices(resource), digital_floorlet_prices(resource) // Checks that for N options, N+1 rates and times, as well as, N strikes and volatilities have been given.
+{
+	continuous_compounding = continuous;
+	price();
+}
+
+
+/**
+* Constructor for a cap and a floor priced together off a shared zero curve, with one optionlet per period of the curve.
+* The curve is read in place, so it must outlive the object.
+* @param strikes const vector double reference, denotes the strike (or exercise) prices of the options.
+* @param volatilities const vector double reference, denotes the interest rate volatilities.
+* @param curve const Discount_Curve reference, denotes the zero curve (N+1 pillars for N optionlets).
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param resource memory_resource pointer, denotes where the arrays of the object are allocated.
+*/
+Rate_Cap_Floor::Rate_Cap_Floor(const std::vector<double>& strikes, const std::vector<double>& volatilities, const Discount_Curve& curve, const bool& continuous, std::pmr::memory_resource* resource)
+	: optionlet_batch(strikes, volatilities, curve, continuous, resource), caplet_prices(resource), floorlet_prices(resource), collar_prices(resource), digital_caplet_prices(resource), digital_floorlet_prices(resource)
+{
+	continuous_compounding = continuous;
+	price();
+}
+
+
+/**
+* Function to value every optionlet once and derive the collar from the caplet and floorlet prices.
+*/
+void Rate_Cap_Floor::price()
+{
+	optionlet_batch.value_optionlets(caplet_prices, floorlet_prices, digital_caplet_prices, digital_floorlet_prices);
+
+	collar_prices.resize(caplet_prices.size());
+	for (std::size_t i = 0; i < caplet_prices.size(); i++)
+	{
+		collar_prices[i] = caplet_prices[i] - floorlet_prices[i];
+	}
+	return;
+}
+
+
+/**
+* Function to sum the optionlet prices of one product.
+* @param prices const vector double reference, denotes the optionlet prices.
+*/
+double Rate_Cap_Floor::total(const std::pmr::vector<double>& prices)
+{
+	double sum = 0;
+	for (auto &p : prices)
+	{
+		sum += p;
+	}
+	return sum;
+}
+
+
+/**
+* Function to print the fair prices of the caplets and floorlets to the console.
+*/
+void Rate_Cap_Floor::print_prices()
+{
+	std::cout << "Cap Prices: ";
+	for (auto &p : caplet_prices)
+	{
+		std::cout << p << " ";
+	}
+	std::cout << std::endl;
+
+	std::cout << "Floor Prices: ";
+	for (auto &p : floorlet_prices)
+	{
+		std::cout << p << " ";
+	}
+	std::cout << std::endl;
+	return;
+}
+
+
+/**
+* Function to print the forward rates to the console.
+*/
+void Rate_Cap_Floor::print_forward_rate()
+{
+	std::cout << "Forward Rates: ";
+	for (auto &p : optionlet_batch.get_forward_rates())
+	{
+		std::cout << p << " ";
+	}
+	std::cout << std::endl;
+	return;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <memory_resource>
+#include "Optionlet_Batch.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Rate_Cap_Floor.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Class to price a cap, floor, collar and digital cap/floor on the same optionlets in one pass.
+*
+* Every array is allocated from the memory resource given on construction (e.g. a Pricing_Workspace), the
+* default heap resource otherwise.
+*/
+class Rate_Cap_Floor
+{
+private:
+	// Attributes
+	Optionlet_Batch optionlet_batch; //Strikes, volatilities, forward rates and discount factors of the optionlets
+	bool continuous_compounding{ false };
+	std::pmr::vector<double> caplet_prices;
+	std::pmr::vector<double> floorlet_prices;
+	std::pmr::vector<double> collar_prices; // long caplet, short floorlet
+	std::pmr::vector<double> digital_caplet_prices;
+	std::pmr::vector<double> digital_floorlet_prices;
+
+	// Methods
+	void price();
+	static double total(const std::pmr::vector<double>& prices);
+
+
+public:
+	// Constructors & Destructor
+	Rate_Cap_Floor(const std::vector<double>& strikes, const std::vector<double>& volatilities, const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const bool& continuous, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+	Rate_Cap_Floor(const std::vector<double>& strikes, const std::vector<double>& volatilities, const Discount_Curve& curve, const bool& continuous, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+	~Rate_Cap_Floor() {};
+
+	// Getter & Print Methods
+	const std::pmr::vector<double>& get_cap_prices() { return caplet_prices; };
+	const std::pmr::vector<double>& get_floor_prices() { return floorlet_prices; };
+	const std::pmr::vector<double>& get_collar_prices() { return collar_prices; };
+	const std::pmr::vector<double>& get_digital_cap_prices() { return digital_caplet_prices; };
+	const std::pmr::vector<double>& get_digital_floor_prices() { return digital_floorlet_prices; };
+	const std::pmr::vector<double>& get_volatilities() { return optionlet_batch.get_volatilities(); };
+	double get_cap_price() { return total(caplet_prices); };
+	double get_floor_price() { return total(floorlet_prices); };
+	double get_collar_price() { return total(collar_prices); };
+	double get_digital_cap_price() { return total(digital_caplet_prices); };
+	double get_digital_floor_price() { return total(digital_floorlet_prices); };
+	void print_prices();
+	void print_forward_rate();
+};
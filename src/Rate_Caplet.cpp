@@ -1,4 +1,5 @@
 #include "Rate_Caplet.h"
+#include "Black_Formula.h"
 
 
 /**
@@ -31,7 +32,7 @@ Rate_Caplet::Rate_Caplet(const double& strike_price, const double& vol, const do
 
 /**
 * Constructor for a call option of known price but unknown volatility.
-* This option inherits from Rate_Derviative and uses linear interpolation
+* This option inherits from Rate_Derviative and inverts the analytic price
 * to determine the volatility of the option.
 * @param strike_price const double reference, denotes the strike (or exercise) price of the option.
 * @param caplet_price const double reference, denotes the fair price of the option.
@@ -44,10 +45,26 @@ Rate_Caplet::Rate_Caplet(const double& strike_price, const double& vol, const do
 Rate_Caplet::Rate_Caplet(const double& strike_price, const double& caplet_price, const double& rate_1,  const double& rate_2, const unsigned int& time_of_rate_1, const unsigned int& time_of_rate_2, const bool& continuous)
 	: Rate_Derivative(strike_price, 0.5, rate_1, time_of_rate_1, rate_2, time_of_rate_2, continuous) //arbitrary vol that will be updated upon construction
 {
-	determine_volatility(caplet_price);
+	determine_volatility(caplet_price, true);
 	price = analytic_price(volatility);
 }
 
+/**
+* Constructor for a call option on one period of a shared zero curve.
+* This option inherits from Rate_Derviative and stores an analytic price.
+* @param strike_price const double reference, denotes the strike (or exercise) price of the option.
+* @param vol const double reference, denotes the interest rate volatility.
+* @param curve const Discount_Curve reference, denotes the zero curve.
+* @param period const size_t reference, denotes the period of the curve (between pillars period and period+1).
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+*/
+Rate_Caplet::Rate_Caplet(const double& strike_price, const double& vol, const Discount_Curve& curve, const std::size_t& period, const bool& continuous)
+	:Rate_Derivative(strike_price, vol, curve, period, continuous)
+{
+	price = analytic_price(volatility);
+}
+
+
 /**
 * Default Constructor for a call option on an underlying interest rate.
 * All parameters and the option price are initialised to 0.
@@ -66,8 +83,7 @@ Rate_Caplet::Rate_Caplet()
 */
 double Rate_Caplet::analytic_price(double vol)
 {
-	double p_2 = derivative_term_struct.get_price_2();
-	double price_at_vol = p_2 * (forward_rate*cdf_normal(d1(vol)) - strike*cdf_normal(d2(vol)));
+	double price_at_vol = discount_factor * black_value(forward_rate, strike, vol * sqrt_t_1, true);
 	return price_at_vol;
 }
 
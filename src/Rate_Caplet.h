@@ -24,6 +24,7 @@ public:
 	// Constructors & Destructor
 	Rate_Caplet(const double& strike_price, const double& vol, const double& rate_1, const unsigned int& time_of_rate_1, const double& rate_2, const unsigned int& time_of_rate_2, const bool& continuous);
 	Rate_Caplet(const double& strike_price, const double& caplet_price, const double& rate_1, const double& rate_2, const unsigned int& time_of_rate_1, const unsigned int& time_of_rate_2, const bool& continuous);
+	Rate_Caplet(const double& strike_price, const double& vol, const Discount_Curve& curve, const std::size_t& period, const bool& continuous);
 	Rate_Caplet();
 	~Rate_Caplet() {};
 
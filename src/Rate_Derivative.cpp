@@ -1,6 +1,5 @@
 #include "Rate_Derivative.h"
 #include <cmath>
-#include <iostream>
 
 /**
 * Project:    Project 1
@@ -46,6 +45,43 @@ Rate_Derivative::Rate_Derivative(const double& strike_price, const double& vol,
 	}
 
 	t_1 = derivative_term_struct.get_t1(); //Needed for pricing the derivative.
+	discount_factor = derivative_term_struct.get_price_2();
+	sqrt_t_1 = sqrt(t_1 / 365.);
+	volatility_status = Vol_Converged;
+	volatility_iterations = 0;
+}
+
+
+/**
+* Constructor for an interest rate derivative on one period of a shared zero curve. The forward
+* rate, start time and discount factor are read from the curve rather than recomputed, and the
+* term structure of the derivative is left empty.
+* @param strike_price const double reference, denotes the strike (or exercise) price of the option.
+* @param vol const double reference, denotes the interest rate volatility.
+* @param curve const Discount_Curve reference, denotes the zero curve.
+* @param period const size_t reference, denotes the period of the curve (between pillars period and period+1).
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+*/
+Rate_Derivative::Rate_Derivative(const double& strike_price, const double& vol, const Discount_Curve& curve, const std::size_t& period, const bool& continuous)
+{
+	if (period >= curve.period_count())
+	{
+		throw 3; // The curve needs a pillar at either end of the period.
+	}
+	else if (strike_price < 0. || vol < 0.)
+	{
+		throw 2; // Ensure all parameters take reasonable values.
+	}
+
+	strike = strike_price;
+	volatility = vol;
+	continuous_compounding = continuous;
+	forward_rate = curve.get_period_forward(period, continuous);
+	t_1 = curve.get_time(period);
+	discount_factor = curve.get_pillar_discount_factor(period + 1);
+	sqrt_t_1 = sqrt(t_1 / 365.);
+	volatility_status = Vol_Converged;
+	volatility_iterations = 0;
 }
 
 
@@ -59,61 +95,27 @@ Rate_Derivative::Rate_Derivative()
 	volatility = 0;
 	forward_rate = 0;
 	t_1 = 0;
+	discount_factor = 0;
+	sqrt_t_1 = 0;
+	volatility_status = Vol_Converged;
+	volatility_iterations = 0;
 	derivative_term_struct = Term_Structure();
 }
 
 
 /**
-* Function to compute the CDF of the standard normal distribution.
-*/
-double Rate_Derivative::cdf_normal(double x)
-{
-	return 0.5 * erfc(-x / sqrt(2));
-}
-
-
-/**
-* Function to linearly interpolate the derivatives volatility,
-* given the derivatives term structure and fair price.
+* Function to infer the derivatives volatility, given the derivatives
+* term structure and fair price (see Implied_Volatility.cpp).
 * @param option_price const double reference, denotes the fair price of the option
+* @param call const boolean reference, denotes whether the option is a caplet(true) or floorlet(false).
 */
-void Rate_Derivative::determine_volatility(const double& option_price)
+void Rate_Derivative::determine_volatility(const double& option_price, const bool& call)
 {
-	// See accompanying pdf for further details
-	// Choose interval [a,b] s.t. y(a)y(b)<0
-	double x_1 = 0.000000001;
-	double y_1 = analytic_price(x_1) - option_price;
-	double x_2 = 0.99999999999;
-	double y_2 = analytic_price(x_2) -option_price;
+	Vol_Result result = Implied_Volatility::solve(option_price, forward_rate, strike, t_1, discount_factor, call);
+	Implied_Volatility::print_warning(result);
 
-	if (y_1*y_2 > 0)
-	{
-		volatility = std::numeric_limits<double>::quiet_NaN();
-		std::cout << "WARNING: negative volatility implied. NaN volatility returned." << std::endl;
-		return;
-	}
-	double x_opt{ 0 };
-	double y_opt{ 100 };
-
-	double tolerance = 0.000000001; //Define breakout tolerance
-	while (abs(y_opt) > tolerance)
-	{
-		// Linearly constrict interval to converge on root
-		x_opt = (1. / (abs(y_2) + abs(y_1))) * ((x_2 * abs(y_1)) + (x_1 * abs(y_2)));
-		y_opt = analytic_price(x_opt) - option_price;
-
-		if (y_opt > 0)
-		{
-			x_2 = x_opt;
-			y_2 = y_opt;
-		}
-		else {
-			x_1 = x_opt;
-			y_1 = y_opt;
-		}
-
-	}
-	
-	volatility = x_opt;
+	volatility = result.volatility;
+	volatility_status = result.status;
+	volatility_iterations = result.iterations;
 	return;
 }
@@ -1,5 +1,8 @@
 #pragma once
 #include "Term_Structure.h"
+#include "Discount_Curve.h"
+#include "Implied_Volatility.h"
+#include <cmath>
 
 
 /**
@@ -20,24 +23,26 @@ protected:
 	double volatility;
 	double forward_rate;
 	double t_1;
+	double discount_factor; // ZCB price at t_2, the payment date
+	double sqrt_t_1; // sqrt(t_1/365), fixed for the life of the derivative
+	Vol_Status volatility_status; // outcome of determine_volatility
+	int volatility_iterations;
 
 
 	//Derivative Methods
-	double cdf_normal(double x);
-	void determine_volatility(const double& option_price); //Infers volatility based off fair price of option
+	void determine_volatility(const double& option_price, const bool& call); //Infers volatility based off fair price of option
 	virtual double analytic_price(double vol)=0; // Implemented in child classes (Rate_Floorlet & Rate_Caplet)
 
-    // Parameters for analytic pricing of derivatives (See Paul Wilmott, Financial Derivatives)
-	double d1(const double& vol) { return 1.0 / vol / sqrt(t_1 / 365.) * (log(forward_rate / strike) + (vol*vol / 2.0) * (t_1 / 365.)); };
-	double d2(const double& vol) { return d1(vol) - vol* sqrt(t_1 / 365.); }; 
-
 public:
 	// Constructors and Destructor
 	Rate_Derivative(const double& strike_price, const double& vol, const double& rate_1, const unsigned int& time_of_rate_1, const double& rate_2, const unsigned int& time_of_rate_2, const bool& continuous);
+	Rate_Derivative(const double& strike_price, const double& vol, const Discount_Curve& curve, const std::size_t& period, const bool& continuous);
 	Rate_Derivative();
 	~Rate_Derivative() {};
 
 	//Getter Methods
 	double get_fwd_rate() { return forward_rate; };
 	double get_volatility() { return volatility; };
+	Vol_Status get_volatility_status() { return volatility_status; };
+	int get_volatility_iterations() { return volatility_iterations; };
 };
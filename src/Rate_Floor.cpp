@@ -1,5 +1,5 @@
 #include "Rate_Floor.h"
-#include <iostream>
+
 
 /**
 * Project:    Project 1
@@ -9,166 +9,66 @@
 * Summary:    Class to store multiple interest rate floorlets.
 */
 
-
 /**
 * Constructor for a rate floor, which is comprised of a set of rate floorlets,
-* that denote a put option on an interest rate. Each floorlet has a fair price,
-* volatility, and a strike price as well as some other dependencies (see Rate_Floorlet.cpp).
+* that denote a put option on an interest rate (see Optionlet_Strip.cpp).
 * @param strikes const vector double reference, denotes the strike (or exercise) prices of the options.
 * @param volatilities const vector double reference, denotes the interest rate volatilities.
 * @param rates const double reference, denotes the interest rates at each discrete time interval t_i.
 * @param time_of_rates const vector usigned int reference, denotes the times at which each of the rates occurs.
 * @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param resource memory_resource pointer, denotes where the arrays of the floor are allocated.
 */
-Rate_Floor::Rate_Floor(const std::vector<double>& strikes, const std::vector<double>& volatilities, const std::vector<double>& rates, std::vector<unsigned int>& time_of_rates, const bool& continuous)
+Rate_Floor::Rate_Floor(const std::vector<double>& strikes, const std::vector<double>& volatilities, const std::vector<double>& rates, std::vector<unsigned int>& time_of_rates, const bool& continuous, std::pmr::memory_resource* resource)
+	: Optionlet_Strip(strikes, volatilities, rates, time_of_rates, continuous, false, resource)
 {
-	int n_rates = rates.size();
-	int n_strikes = strikes.size();
-	int n_volatilities = volatilities.size();
-	int n_dates = time_of_rates.size();
-
-	if (((n_rates - 1) != n_strikes) || (n_volatilities != n_strikes) || ((n_rates - 1) != n_volatilities) || (n_dates != n_rates) || ((n_dates - 1) != n_strikes))
-	{
-		throw 3; // Check that for N options, N+1 rates and times, as well as, N strikes and volatilities have been given.
-	}
-
-	interest_rates = rates;
-	floorlet_strikes = strikes;
-	maturities = time_of_rates;
-	floorlet_volatilities = volatilities;
-	continuous_compounding = continuous;
-
-	std::vector<Rate_Floorlet> floors(n_strikes, Rate_Floorlet());
-	std::vector<double> prices(n_strikes, 0);
-	std::vector<double> forward_rates(n_strikes, 0);
-	
-	// Construct each floorlet based on the given parameters-store the prices and forward rates.
-	if (continuous_compounding)
-	{
-		for (int i = 0; i < n_strikes; i++)
-		{
-			Rate_Floorlet floorlet = Rate_Floorlet(floorlet_strikes.at(i), floorlet_volatilities.at(i), interest_rates.at(i), maturities.at(i), interest_rates.at(i + 1), maturities.at(i + 1), true);
-			floors.at(i) = floorlet;
-			prices.at(i) = floorlet.get_price();
-			forward_rates.at(i) = floorlet.get_fwd_rate();
-		}
-	}
-	else {
-
-		for (int i = 0; i < n_strikes; i++)
-		{
-			Rate_Floorlet floorlet = Rate_Floorlet(floorlet_strikes.at(i), floorlet_volatilities.at(i), interest_rates.at(i), maturities.at(i), interest_rates.at(i + 1), maturities.at(i + 1), false);
-			floors.at(i) = floorlet;
-			prices.at(i) = floorlet.get_price();
-			forward_rates.at(i) = floorlet.get_fwd_rate();
-		}
-	}
-	floorlet_forward_rates = forward_rates;
-	floorlets = floors;
-	floorlet_prices = prices;
 }
 
 
 /**
-* Constructor for a rate floor, which is comprised of a set of rate floorlets,
-* this constructor takes in the price of each floorlet and calculates the corresponding 
-* volatility.Each floorlet has a fair price, volatility, and a strike price as well as 
-* some other dependencies (see Rate_Floorlet.cpp).
+* Constructor for a rate floor from the price of each floorlet, inferring the corresponding volatilities.
 * @param strikes const vector double reference, denotes the strike (or exercise) prices of the options.
 * @param prices const vector double reference, denotes the price of each floorlet.
 * @param time_of_rates const vector usigned int reference, denotes the times at which each of the rates occurs.
 * @param rates const double reference, denotes the interest rates at each discrete time interval t_i.
 * @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param resource memory_resource pointer, denotes where the arrays of the floor are allocated.
 */
-Rate_Floor::Rate_Floor(const std::vector<double>& strikes, const std::vector<double>& prices, std::vector<unsigned int>& time_of_rates, const std::vector<double>& rates, const bool& continuous)
+Rate_Floor::Rate_Floor(const std::vector<double>& strikes, const std::vector<double>& prices, std::vector<unsigned int>& time_of_rates, const std::vector<double>& rates, const bool& continuous, std::pmr::memory_resource* resource)
+	: Optionlet_Strip(strikes, prices, time_of_rates, rates, continuous, false, resource)
 {
-	int n_rates = rates.size();
-	int n_strikes = strikes.size();
-	int n_prices = prices.size();
-	int n_dates = time_of_rates.size();
-
-	if (((n_rates - 1) != n_strikes) || (n_prices != n_strikes) || ((n_rates - 1) != n_prices) || (n_dates != n_rates) || ((n_dates - 1) != n_strikes))
-	{
-		throw 3; // Check that for N options, N+1 rates and times, as well as, N strikes and volatilities have been given.
-	}
-
-	interest_rates = rates;
-	floorlet_strikes = strikes;
-	maturities = time_of_rates;
-	floorlet_prices = prices;
-	continuous_compounding = continuous;
-
-	std::vector<Rate_Floorlet> floors(n_strikes, Rate_Floorlet());
-	std::vector<double> volatilities(n_strikes, 0);
-	std::vector<double> forward_rates(n_strikes, 0);
-
-	// Construct each floorlet based on the given parameters-store the prices and forward rates.
-	if (continuous_compounding)
-	{
-		for (int i = 0; i < n_strikes; i++)
-		{
-			Rate_Floorlet floorlet = Rate_Floorlet(floorlet_strikes.at(i), prices.at(i), interest_rates.at(i), interest_rates.at(i + 1), maturities.at(i), maturities.at(i + 1), true);
-			floors.at(i) = floorlet;
-			volatilities.at(i) = floorlet.get_volatility();
-			forward_rates.at(i) = floorlet.get_fwd_rate();
-		}
-	}
-	else {
-
-		for (int i = 0; i < n_strikes; i++)
-		{
-			Rate_Floorlet floorlet = Rate_Floorlet(floorlet_strikes.at(i), prices.at(i), interest_rates.at(i), interest_rates.at(i + 1), maturities.at(i), maturities.at(i + 1), false);
-			floors.at(i) = floorlet;
-			volatilities.at(i) = floorlet.get_volatility();
-			forward_rates.at(i) = floorlet.get_fwd_rate();
-		}
-	}
-
-	floorlet_forward_rates = forward_rates;
-	floorlets = floors;
-	floorlet_volatilities = volatilities;
 }
 
 
 /**
-* Function to print the fair prices of the floorlets to the console.
-*/
-void Rate_Floor::print_prices()
-{
-	std::cout << "Floor Prices: ";
-	for (auto &p : floorlet_prices)
-	{
-		std::cout << p << " ";
-	}
-	std::cout << std::endl;
-	return;
-}
-
-/**
-* Function to print the inferred volatilities to the console.
+* Constructor for a rate floor priced off a shared zero curve, with one floorlet per period of the
+* curve. The curve is read in place, so it must outlive the object.
+* @param strikes const vector double reference, denotes the strike (or exercise) prices of the options.
+* @param volatilities const vector double reference, denotes the interest rate volatilities.
+* @param curve const Discount_Curve reference, denotes the zero curve (N+1 pillars for N floorlets).
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param resource memory_resource pointer, denotes where the arrays of the floor are allocated.
 */
-void Rate_Floor::print_volatilities()
+Rate_Floor::Rate_Floor(const std::vector<double>& strikes, const std::vector<double>& volatilities, const Discount_Curve& curve, const bool& continuous, std::pmr::memory_resource* resource)
+	: Optionlet_Strip(strikes, volatilities, curve, continuous, false, resource)
 {
-	std::cout << "Floor Volatilities: ";
-	for (auto &p : floorlet_volatilities)
-	{
-		std::cout << p << " ";
-	}
-	std::cout << std::endl;
-	return;
 }
 
 
 /**
-* Function to print the forward rates to the console.
+* Function to price a floor written on consecutive periods of the zero rates without constructing one:
+* the inputs are read in place and the floorlet prices written to the caller's array, so repricing a
+* book held in the caller's own buffers makes no heap allocation and copies nothing.
+* @param strikes const double pointer, denotes the strike (or exercise) prices of the options.
+* @param volatilities const double pointer, denotes the interest rate volatilities.
+* @param rates const double pointer, denotes the interest rates at each discrete time interval t_i (n_floorlets + 1).
+* @param time_of_rates const unsigned int pointer, denotes the times at which each of the rates occurs (n_floorlets + 1).
+* @param n_floorlets const size_t reference, denotes the number of floorlets.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param prices double pointer, denotes the output array of floorlet prices (length n_floorlets).
+* @param freq const int reference, denotes the compounding frequency.
 */
-void Rate_Floor::print_forward_rate()
+void Rate_Floor::price(const double* strikes, const double* volatilities, const double* rates, const unsigned int* time_of_rates, const std::size_t& n_floorlets, const bool& continuous, double* prices, const int& freq)
 {
-	std::cout << "Forward Rates: ";
-	for (auto &p : floorlet_forward_rates)
-	{
-		std::cout << p << " ";
-	}
-	std::cout << std::endl;
-	return;
+	Optionlet_Batch::curve_prices(strikes, volatilities, rates, time_of_rates, n_floorlets, continuous, freq, false, prices);
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include "Rate_Floorlet.h"
+#include "Optionlet_Strip.h"
 
 
 /**
@@ -9,31 +10,15 @@
 * Author:     Ryan Sephton
 * Summary:    Class to store multiple interest rate floorlets.
 */
-class Rate_Floor
+class Rate_Floor : public Optionlet_Strip
 {
-private:
-	// Attributes
-	std::vector<Rate_Floorlet> floorlets; //Floorlets that comprise the floor
-	bool continuous_compounding{ false };
-	std::vector<double> floorlet_prices;
-	std::vector<double> floorlet_forward_rates;
-	std::vector<double> interest_rates;
-	std::vector<unsigned int> maturities;
-	std::vector<double> floorlet_volatilities;
-	std::vector<double> floorlet_strikes;
-
-
 public:
-	// Constructor & Destructor
-	Rate_Floor(const std::vector<double>& strikes, const std::vector<double>& volatilities, const std::vector<double>& rates, std::vector<unsigned int>& time_of_rates, const bool& continuous);
-	Rate_Floor(const std::vector<double>& strikes, const std::vector<double>& prices, std::vector<unsigned int>& time_of_rates, const std::vector<double>& rates, const bool& continuous);
+	// Constructor & Destructor (see Optionlet_Strip.h for the getters and print methods)
+	Rate_Floor(const std::vector<double>& strikes, const std::vector<double>& volatilities, const std::vector<double>& rates, std::vector<unsigned int>& time_of_rates, const bool& continuous, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+	Rate_Floor(const std::vector<double>& strikes, const std::vector<double>& prices, std::vector<unsigned int>& time_of_rates, const std::vector<double>& rates, const bool& continuous, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+	Rate_Floor(const std::vector<double>& strikes, const std::vector<double>& volatilities, const Discount_Curve& curve, const bool& continuous, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 	~Rate_Floor() {};
 
-	// Getter & Print Methods
-	std::vector<double> get_prices() { return floorlet_prices; };
-	std::vector<double> get_volatilities() { return floorlet_volatilities; };
-	void print_prices();
-	void print_volatilities();
-	void print_forward_rate();
+	// Pricing from caller-owned arrays (no allocation, no copies)
+	static void price(const double* strikes, const double* volatilities, const double* rates, const unsigned int* time_of_rates, const std::size_t& n_floorlets, const bool& continuous, double* prices, const int& freq = 4);
 };
-
@@ -1,4 +1,5 @@
 #include "Rate_Floorlet.h"
+#include "Black_Formula.h"
 
 /**
 * Project:    Project 1
@@ -29,7 +30,7 @@ Rate_Floorlet::Rate_Floorlet(const double& strike_price, const double& vol, cons
 
 /**
 * Constructor for a put option of known price but unknown volatility.
-* This option inherits from Rate_Derviative and uses linear interpolation
+* This option inherits from Rate_Derviative and inverts the analytic price
 * to determine the volatility of the option.
 * @param strike_price const double reference, denotes the strike (or exercise) price of the option.
 * @param floorlet_price const double reference, denotes the fair price of the option.
@@ -42,7 +43,23 @@ Rate_Floorlet::Rate_Floorlet(const double& strike_price, const double& vol, cons
 Rate_Floorlet::Rate_Floorlet(const double& strike_price, const double& floorlet_price, const double& rate_1, const double& rate_2, const unsigned int& time_of_rate_1, const unsigned int& time_of_rate_2, const bool& continuous)
 	: Rate_Derivative(strike_price, 0.5, rate_1, time_of_rate_1, rate_2, time_of_rate_2, continuous) //arbitrary vol that will be updated upon construction
 {
-	determine_volatility(floorlet_price);
+	determine_volatility(floorlet_price, false);
+	price = analytic_price(volatility);
+}
+
+
+/**
+* Constructor for a put option on one period of a shared zero curve.
+* This option inherits from Rate_Derviative and stores an analytic price.
+* @param strike_price const double reference, denotes the strike (or exercise) price of the option.
+* @param vol const double reference, denotes the interest rate volatility.
+* @param curve const Discount_Curve reference, denotes the zero curve.
+* @param period const size_t reference, denotes the period of the curve (between pillars period and period+1).
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+*/
+Rate_Floorlet::Rate_Floorlet(const double& strike_price, const double& vol, const Discount_Curve& curve, const std::size_t& period, const bool& continuous)
+	:Rate_Derivative(strike_price, vol, curve, period, continuous)
+{
 	price = analytic_price(volatility);
 }
 
@@ -64,8 +81,7 @@ Rate_Floorlet::Rate_Floorlet()
 */
 double Rate_Floorlet::analytic_price(double vol)
 {
-	double p_2 = derivative_term_struct.get_price_2(); 
-	double price_at_vol = -p_2 * (forward_rate*cdf_normal(-1.*d1(vol)) - strike*cdf_normal(-1.*d2(vol)));
+	double price_at_vol = discount_factor * black_value(forward_rate, strike, vol * sqrt_t_1, false);
 	return price_at_vol;
 }
 
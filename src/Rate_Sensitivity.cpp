@@ -0,0 +1,158 @@
+#include "Rate_Sensitivity.h"
+#include "Compounding.h"
+#include "Dual_Number.h"
+#include "Black_Formula.h"
+#include <cmath>
+#include <iostream>
+
+
+/**
+* Project:    Project 1
+* Filename:   Rate_Sensitivity.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Adjoint (reverse mode) sensitivities of a cap and a floor to every zero rate and volatility.
+*/
+
+
+/**
+* Constructor for the prices and first order sensitivities of a cap and a floor with the same strikes,
+* volatilities and zero rates. The forward pass follows Optionlet_Batch::forward_curve and Black's formula
+* (see Term_Structure.cpp, Rate_Caplet.cpp and Rate_Floorlet.cpp). The reverse pass then propagates the
+* adjoint of each optionlet price back through its forward rate and discount factor to the zero rates,
+* so the full gradient of both products costs about one extra pricing rather than 2(N+1) repricings.
+* @param strikes const vector double reference, denotes the strike (or exercise) prices of the options.
+* @param volatilities const vector double reference, denotes the interest rate volatilities.
+* @param rates const vector double reference, denotes the interest rates at each discrete time interval t_i.
+* @param time_of_rates const vector usigned int reference, denotes the times at which each of the rates occurs.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param freq const int reference, denotes the compounding frequency.
+*/
+Rate_Sensitivity::Rate_Sensitivity(const std::vector<double>& strikes, const std::vector<double>& volatilities, const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const bool& continuous, const int& freq)
+{
+	n_optionlets = strikes.size();
+	if (volatilities.size() != n_optionlets || rates.size() != n_optionlets + 1 || time_of_rates.size() != n_optionlets + 1)
+	{
+		throw 3; // Check that for N options, N + 1 rates and times, as well as, N strikes and volatilities have been given.
+	}
+	for (std::size_t i = 0; i < n_optionlets; i++)
+	{
+		if (strikes[i] < 0. || volatilities[i] < 0.)
+		{
+			throw 2;
+		}
+	}
+	for (std::size_t j = 0; j < rates.size(); j++)
+	{
+		if (rates[j] <= 0 || time_of_rates[j] <= 0 || freq <= 0)
+		{
+			throw 2; // All rates, times, and compounding frequency must be positive.
+		}
+		if (j > 0 && time_of_rates[j] <= time_of_rates[j - 1])
+		{
+			throw 1; // Second rate should occur chronologically after the first, i.e. t_1 < t_2.
+		}
+	}
+
+	caplet_prices.assign(n_optionlets, 0);
+	floorlet_prices.assign(n_optionlets, 0);
+	cap_rate_deltas.assign(n_optionlets + 1, 0);
+	floor_rate_deltas.assign(n_optionlets + 1, 0);
+	vegas.assign(n_optionlets, 0);
+	cap_price = 0;
+	floor_price = 0;
+
+	for (std::size_t i = 0; i < n_optionlets; i++)
+	{
+		// Forward pass: log(P_1/P_2) = r_2 T_2 - r_1 T_1, forward rate and discount factor of the period
+		double T_1 = time_of_rates[i] / double(365);
+		double T_2 = time_of_rates[i + 1] / double(365);
+		double log_ratio = rates[i + 1] * T_2 - rates[i] * T_1;
+		double discount = exp(-1 * rates[i + 1] * T_2);
+		Dual seeded_log_ratio(log_ratio, 1.); // the policy evaluated on a Dual also gives d forward / d log_ratio
+		Dual forward_dual = continuous
+			? Continuous_Compounding::forward_from_log_ratio(seeded_log_ratio, time_of_rates[i], time_of_rates[i + 1], freq)
+			: Discrete_Compounding::forward_from_log_ratio(seeded_log_ratio, time_of_rates[i], time_of_rates[i + 1], freq);
+		double forward = forward_dual.value;
+		double d_forward_d_log_ratio = forward_dual.derivative;
+
+		double cap_d_forward, cap_d_discount, floor_d_forward, floor_d_discount, d_vol;
+		double caplet = black_adjoint(strikes[i], volatilities[i], forward, time_of_rates[i], discount, true, cap_d_forward, cap_d_discount, d_vol);
+		double floorlet = black_adjoint(strikes[i], volatilities[i], forward, time_of_rates[i], discount, false, floor_d_forward, floor_d_discount, d_vol); // not by parity, which cancels out of the money
+
+		caplet_prices[i] = caplet;
+		floorlet_prices[i] = floorlet;
+		cap_price += caplet;
+		floor_price += floorlet;
+		vegas[i] = d_vol;
+
+		// Reverse pass: price adjoints -> forward and discount adjoints -> zero rate adjoints
+		double cap_bar_log_ratio = cap_d_forward * d_forward_d_log_ratio;
+		double floor_bar_log_ratio = floor_d_forward * d_forward_d_log_ratio;
+		double cap_bar_discount = cap_d_discount;
+		double floor_bar_discount = floor_d_discount;
+
+		cap_rate_deltas[i] -= cap_bar_log_ratio * T_1;
+		cap_rate_deltas[i + 1] += cap_bar_log_ratio * T_2 - cap_bar_discount * T_2 * discount;
+		floor_rate_deltas[i] -= floor_bar_log_ratio * T_1;
+		floor_rate_deltas[i + 1] += floor_bar_log_ratio * T_2 - floor_bar_discount * T_2 * discount;
+	}
+}
+
+
+/**
+* Function to price one optionlet with Black's formula and return the partial derivatives of the price. The partials
+* come from black_value (see Black_Formula.h) evaluated on Dual numbers, seeded once along the forward rate and
+* once along the volatility, so they follow the pricing formula exactly rather than a hand-written derivative.
+* @param strike const double reference, denotes the strike of the optionlet.
+* @param vol const double reference, denotes the volatility of the optionlet.
+* @param forward const double reference, denotes the forward rate of the optionlet.
+* @param t_1 const double reference, denotes the time (days) at which the rate is set.
+* @param discount const double reference, denotes the ZCB price at the payment date.
+* @param call const boolean reference, denotes whether the optionlet is a caplet(true) or floorlet(false).
+* @param d_forward double reference, set to the derivative of the price w.r.t. the forward rate.
+* @param d_discount double reference, set to the derivative of the price w.r.t. the discount factor.
+* @param d_vol double reference, set to the derivative of the price w.r.t. the volatility (vega).
+*/
+double Rate_Sensitivity::black_adjoint(const double& strike, const double& vol, const double& forward, const double& t_1, const double& discount, const bool& call, double& d_forward, double& d_discount, double& d_vol)
+{
+	double sqrt_t_1 = sqrt(t_1 / 365.);
+	Dual by_forward = black_value(Dual(forward, 1.), Dual(strike), Dual(vol * sqrt_t_1), call);
+	Dual by_vol = black_value(Dual(forward), Dual(strike), Dual(vol * sqrt_t_1, sqrt_t_1), call);
+
+	d_forward = discount * by_forward.derivative;
+	d_discount = by_forward.value;
+	d_vol = discount * by_vol.derivative;
+	return discount * by_forward.value;
+}
+
+
+/**
+* Function to print the prices and sensitivities to the console.
+*/
+void Rate_Sensitivity::print_sensitivities()
+{
+	std::cout << "Cap Price: " << cap_price << " Floor Price: " << floor_price << std::endl;
+
+	std::cout << "Cap Rate Deltas: ";
+	for (auto &d : cap_rate_deltas)
+	{
+		std::cout << d << " ";
+	}
+	std::cout << std::endl;
+
+	std::cout << "Floor Rate Deltas: ";
+	for (auto &d : floor_rate_deltas)
+	{
+		std::cout << d << " ";
+	}
+	std::cout << std::endl;
+
+	std::cout << "Vegas: ";
+	for (auto &v : vegas)
+	{
+		std::cout << v << " ";
+	}
+	std::cout << std::endl;
+	return;
+}
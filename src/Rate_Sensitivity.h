@@ -0,0 +1,44 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+
+
+/**
+* Project:    Project 1
+* Filename:   Rate_Sensitivity.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Adjoint (reverse mode) sensitivities of a cap and a floor to every zero rate and volatility.
+*/
+class Rate_Sensitivity
+{
+private:
+	// Attributes
+	std::size_t n_optionlets;
+	double cap_price;
+	double floor_price;
+	std::vector<double> caplet_prices;
+	std::vector<double> floorlet_prices;
+	std::vector<double> cap_rate_deltas; // d cap / d rates[j], one per pillar
+	std::vector<double> floor_rate_deltas; // d floor / d rates[j], one per pillar
+	std::vector<double> vegas; // d caplet_i / d vol_i = d floorlet_i / d vol_i
+
+
+public:
+	// Constructor & Destructor
+	Rate_Sensitivity(const std::vector<double>& strikes, const std::vector<double>& volatilities, const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const bool& continuous, const int& freq = 4);
+	~Rate_Sensitivity() {};
+
+	// Adjoint of Black's formula for one optionlet: price and the partials w.r.t. forward, discount factor and vol
+	static double black_adjoint(const double& strike, const double& vol, const double& forward, const double& t_1, const double& discount, const bool& call, double& d_forward, double& d_discount, double& d_vol);
+
+	// Getter & Print Methods
+	double get_cap_price() { return cap_price; };
+	double get_floor_price() { return floor_price; };
+	const std::vector<double>& get_caplet_prices() { return caplet_prices; };
+	const std::vector<double>& get_floorlet_prices() { return floorlet_prices; };
+	const std::vector<double>& get_cap_rate_deltas() { return cap_rate_deltas; };
+	const std::vector<double>& get_floor_rate_deltas() { return floor_rate_deltas; };
+	const std::vector<double>& get_vegas() { return vegas; };
+	void print_sensitivities();
+};
@@ -0,0 +1,466 @@
+#include "Sabr_Calibration.h"
+#include <cmath>
+#include <limits>
+
+
+/**
+* Project:    Project 1
+* Filename:   Sabr_Calibration.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Per expiry SABR smile calibration by Levenberg-Marquardt with analytic Jacobians, run in parallel.
+*/
+
+
+namespace
+{
+	const double max_atanh_rho = 5.; // |rho| <= 0.9999
+	const double min_log = -30.; // bounds on log(alpha) and log(nu)
+	const double max_log = 5.;
+	const double cold_rhos[] = { -0.6, -0.3, 0., 0.3, 0.6 }; // starting grid of a cold fit
+	const double cold_nus[] = { 0.1, 0.3, 0.6, 1.2 };
+	const double price_tolerance = 1e-9; // relative, so far out of the money prices still pin down their volatility
+
+
+	/**
+	* Function to map the unconstrained variables (log(alpha), atanh(rho), log(nu)) to SABR parameters.
+	*/
+	inline Sabr_Parameters to_parameters(const double* u, const double& beta)
+	{
+		return Sabr_Parameters{ exp(u[0]), beta, tanh(u[1]), exp(u[2]) };
+	}
+
+
+	/**
+	* Function to clamp the unconstrained variables to the range searched.
+	*/
+	inline void clamp_variables(double* u)
+	{
+		u[0] = u[0] < min_log ? min_log : (u[0] > max_log ? max_log : u[0]);
+		u[1] = u[1] < -max_atanh_rho ? -max_atanh_rho : (u[1] > max_atanh_rho ? max_atanh_rho : u[1]);
+		u[2] = u[2] < min_log ? min_log : (u[2] > max_log ? max_log : u[2]);
+	}
+
+
+	/**
+	* Function to check a quote can be used in the fit.
+	*/
+	inline bool usable(const double& strike, const double& vol)
+	{
+		return strike > 0 && vol > 0 && std::isfinite(strike) && std::isfinite(vol);
+	}
+
+
+	/**
+	* Function to return the squared error of the SABR volatilities over the usable quotes of an expiry. When
+	* gradient is given it also accumulates J^T r and J^T J (upper triangle, row by row) with J the Jacobian of
+	* the residuals in the unconstrained variables.
+	*/
+	double squared_error(const Sabr_Parameters& parameters, const double* strikes, const double* vols, const std::size_t& n_strikes, const double& forward, const double& t_1, double* gradient, double* hessian)
+	{
+		double cost = 0;
+		double d[3];
+		if (gradient)
+		{
+			for (int i = 0; i < 3; i++)
+			{
+				gradient[i] = 0;
+				hessian[i] = 0;
+				hessian[i + 3] = 0;
+			}
+		}
+
+		for (std::size_t k = 0; k < n_strikes; k++)
+		{
+			if (!usable(strikes[k], vols[k]))
+			{
+				continue;
+			}
+			double residual = Sabr_Calibration::volatility(parameters, forward, strikes[k], t_1, gradient ? d : nullptr) - vols[k];
+			cost += residual * residual;
+			if (gradient)
+			{
+				// Chain rule into log(alpha), atanh(rho), log(nu)
+				d[0] *= parameters.alpha;
+				d[1] *= 1 - parameters.rho * parameters.rho;
+				d[2] *= parameters.nu;
+				gradient[0] += d[0] * residual;
+				gradient[1] += d[1] * residual;
+				gradient[2] += d[2] * residual;
+				hessian[0] += d[0] * d[0];
+				hessian[1] += d[0] * d[1];
+				hessian[2] += d[0] * d[2];
+				hessian[3] += d[1] * d[1];
+				hessian[4] += d[1] * d[2];
+				hessian[5] += d[2] * d[2];
+			}
+		}
+		return cost;
+	}
+
+
+	/**
+	* Function to solve the damped normal equations (J^T J + lambda diag(J^T J)) step = -J^T r by Cramer's rule.
+	* Returns false when the system is singular.
+	*/
+	bool damped_step(const double* gradient, const double* hessian, const double& lambda, double* step)
+	{
+		double a00 = hessian[0] * (1 + lambda) + 1e-300;
+		double a11 = hessian[3] * (1 + lambda) + 1e-300;
+		double a22 = hessian[5] * (1 + lambda) + 1e-300;
+		double a01 = hessian[1];
+		double a02 = hessian[2];
+		double a12 = hessian[4];
+
+		double c00 = a11 * a22 - a12 * a12;
+		double c01 = a02 * a12 - a01 * a22;
+		double c02 = a01 * a12 - a02 * a11;
+		double det = a00 * c00 + a01 * c01 + a02 * c02;
+		if (!(std::fabs(det) > 0) || !std::isfinite(det))
+		{
+			return false;
+		}
+		double c11 = a00 * a22 - a02 * a02;
+		double c12 = a01 * a02 - a00 * a12;
+		double c22 = a00 * a11 - a01 * a01;
+
+		step[0] = -(c00 * gradient[0] + c01 * gradient[1] + c02 * gradient[2]) / det;
+		step[1] = -(c01 * gradient[0] + c11 * gradient[1] + c12 * gradient[2]) / det;
+		step[2] = -(c02 * gradient[0] + c12 * gradient[1] + c22 * gradient[2]) / det;
+		return std::isfinite(step[0]) && std::isfinite(step[1]) && std::isfinite(step[2]);
+	}
+}
+
+
+/**
+* Constructor for a calibration context.
+* @param sabr_beta const double reference, denotes the fixed beta of every expiry (between 0 and 1).
+* @param tol const double reference, denotes the relative improvement of the squared error (or the step in
+*        the unconstrained variables) below which a fit has converged.
+* @param max_iter const int reference, denotes the maximum number of Levenberg-Marquardt steps per expiry.
+*/
+Sabr_Calibration::Sabr_Calibration(const double& sabr_beta, const double& tol, const int& max_iter)
+{
+	if (!(sabr_beta >= 0 && sabr_beta <= 1) || !(tol > 0) || max_iter < 1)
+	{
+		throw 2;
+	}
+	beta = sabr_beta;
+	tolerance = tol;
+	max_iterations = max_iter;
+}
+
+
+/**
+* Function to return the lognormal volatility of the SABR model from the expansion of Hagan, Kumar, Lesniewski
+* and Woodward (2002) "Managing smile risk", with its derivatives in alpha, rho and nu if requested.
+* @param parameters const Sabr_Parameters reference, denotes alpha, beta, rho and nu.
+* @param forward const double reference, denotes the forward rate.
+* @param strike const double reference, denotes the strike.
+* @param t_1 const double reference, denotes the expiry (days).
+* @param gradient double pointer, denotes the output array of the 3 derivatives (ignored if null).
+*/
+double Sabr_Calibration::volatility(const Sabr_Parameters& parameters, const double& forward, const double& strike, const double& t_1, double* gradient)
+{
+	const double& alpha = parameters.alpha;
+	const double& beta = parameters.beta;
+	const double& rho = parameters.rho;
+	const double& nu = parameters.nu;
+	double t = t_1 / 365.;
+
+	// Leading factor alpha / ((F K)^((1-beta)/2) (1 + (1-beta)^2/24 log^2(F/K) + (1-beta)^4/1920 log^4(F/K)))
+	double one_beta = 1 - beta;
+	double one_beta_2 = one_beta * one_beta;
+	double log_fk = log(forward / strike);
+	double log_fk_2 = log_fk * log_fk;
+	double fk_beta = pow(forward * strike, 0.5 * one_beta);
+	double a = alpha / (fk_beta * (1 + one_beta_2 / 24 * log_fk_2 + one_beta_2 * one_beta_2 / 1920 * log_fk_2 * log_fk_2));
+
+	// Smile factor z / x(z), near the money from the series of x(z) / z (1/s generates the Legendre polynomials)
+	double z_over_nu = fk_beta * log_fk / alpha;
+	double z = nu * z_over_nu;
+	double g, dg_dz, dg_drho;
+	if (std::fabs(z) < 1e-3)
+	{
+		double rho_2 = rho * rho;
+		double c1 = rho / 2;
+		double c2 = (3 * rho_2 - 1) / 6;
+		double c3 = (5 * rho_2 - 3) * rho / 8;
+		double c4 = ((35 * rho_2 - 30) * rho_2 + 3) / 40;
+		double x_over_z = 1 + z * (c1 + z * (c2 + z * (c3 + z * c4)));
+		double dx_dz = c1 + z * (2 * c2 + z * (3 * c3 + z * 4 * c4));
+		double dx_drho = z * (0.5 + z * (rho + z * ((15 * rho_2 - 3) / 8 + z * (140 * rho_2 - 60) * rho / 40)));
+		g = 1 / x_over_z;
+		dg_dz = -dx_dz * g * g;
+		dg_drho = -dx_drho * g * g;
+	}
+	else {
+		double s = sqrt(1 - 2 * rho * z + z * z);
+		double x = log((s + z - rho) / (1 - rho));
+		g = z / x;
+		dg_dz = (x - z / s) / (x * x); // dx/dz = 1/s
+		dg_drho = -z * ((-z / s - 1) / (s + z - rho) + 1 / (1 - rho)) / (x * x);
+	}
+
+	// Time correction 1 + ((1-beta)^2/24 alpha^2/(FK)^(1-beta) + rho beta nu alpha/(4 (FK)^((1-beta)/2)) + (2-3 rho^2)/24 nu^2) t
+	double b = 1 + (one_beta_2 / 24 * alpha * alpha / (fk_beta * fk_beta) + rho * beta * nu * alpha / (4 * fk_beta) + (2 - 3 * rho * rho) / 24 * nu * nu) * t;
+	double vol = a * g * b;
+
+	if (gradient)
+	{
+		double db_dalpha = (one_beta_2 / 12 * alpha / (fk_beta * fk_beta) + rho * beta * nu / (4 * fk_beta)) * t;
+		double db_drho = (beta * nu * alpha / (4 * fk_beta) - rho * nu * nu / 4) * t;
+		double db_dnu = (rho * beta * alpha / (4 * fk_beta) + (2 - 3 * rho * rho) / 12 * nu) * t;
+		gradient[0] = vol / alpha - a * dg_dz * (z / alpha) * b + a * g * db_dalpha; // dz/dalpha = -z/alpha
+		gradient[1] = a * dg_drho * b + a * g * db_drho;
+		gradient[2] = a * dg_dz * z_over_nu * b + a * g * db_dnu;
+	}
+	return vol;
+}
+
+
+/**
+* Function to calibrate every expiry of a grid of volatilities, in parallel. Expiries calibrated before on a
+* grid with the same number of expiries start from their previous parameters, the others from the ATM alpha and
+* the best rho and nu of a coarse grid (see fit). Quotes with a non-positive or non-finite strike or volatility
+* are left out of the fit.
+* @param strikes const double pointer, denotes the strikes, [expiry][strike].
+* @param vols const double pointer, denotes the quoted volatilities, [expiry][strike].
+* @param forwards const double pointer, denotes the forward rate of each expiry.
+* @param t_1 const double pointer, denotes each expiry (days).
+* @param n_expiries const size_t reference, denotes the number of expiries.
+* @param n_strikes const size_t reference, denotes the number of strikes per expiry.
+* @param pool Thread_Pool reference, denotes the threads the expiries are shared across.
+*/
+void Sabr_Calibration::calibrate(const double* strikes, const double* vols, const double* forwards, const double* t_1, const std::size_t& n_expiries, const std::size_t& n_strikes, Thread_Pool& pool)
+{
+	calibrate_grid(strikes, vols, nullptr, forwards, t_1, nullptr, n_expiries, n_strikes, true, pool);
+}
+
+
+/**
+* Function to calibrate every expiry of a grid of caplet or floorlet prices, in parallel. The prices are first
+* inverted to volatilities (see Implied_Volatility::solve), warm started from the previous smile when there is
+* one, to a price tolerance relative to the quote so far out of the money strikes keep their information. Prices
+* that cannot be inverted are left out of the fit (see get_market_volatilities).
+* @param prices const double pointer, denotes the option prices, [expiry][strike].
+* @param discounts const double pointer, denotes the ZCB price at the end of each expiry's period.
+* @param call const boolean reference, denotes whether the prices are of caplets(true) or floorlets(false).
+* Remaining parameters as for calibrate.
+*/
+void Sabr_Calibration::calibrate_prices(const double* strikes, const double* prices, const double* forwards, const double* t_1, const double* discounts, const std::size_t& n_expiries, const std::size_t& n_strikes, const bool& call, Thread_Pool& pool)
+{
+	market_volatilities.resize(n_expiries * n_strikes);
+	vol_results.resize(n_expiries * n_strikes);
+	calibrate_grid(strikes, market_volatilities.data(), prices, forwards, t_1, discounts, n_expiries, n_strikes, call, pool);
+}
+
+
+/**
+* Function to run the calibration of each expiry on the pool, inverting the prices first when given (vols then
+* points to market_volatilities). Parameters as for calibrate_prices.
+*/
+void Sabr_Calibration::calibrate_grid(const double* strikes, const double* vols, const double* prices, const double* forwards, const double* t_1, const double* discounts, const std::size_t& n_expiries, const std::size_t& n_strikes, const bool& call, Thread_Pool& pool)
+{
+	const double nan = std::numeric_limits<double>::quiet_NaN();
+	bool warm_grid = results.size() == n_expiries;
+	if (!warm_grid)
+	{
+		results.assign(n_expiries, Sabr_Result{ { nan, beta, nan, nan }, nan, 0, 0, Sabr_Invalid_Input });
+	}
+	for (std::size_t j = 0; j < n_expiries; j++)
+	{
+		if (warm_grid && results[j].status != Sabr_Invalid_Input)
+		{
+			warm_starts++;
+		}
+	}
+	forward_rates.assign(forwards, forwards + n_expiries);
+	expiries.assign(t_1, t_1 + n_expiries);
+
+	pool.parallel_for(n_expiries, [&](std::size_t begin, std::size_t end)
+	{
+		for (std::size_t j = begin; j < end; j++)
+		{
+			bool warm = warm_grid && results[j].status != Sabr_Invalid_Input;
+			const double* row_strikes = strikes + j * n_strikes;
+			if (prices)
+			{
+				for (std::size_t k = 0; k < n_strikes; k++)
+				{
+					std::size_t cell = j * n_strikes + k;
+					double guess = warm ? volatility(results[j].parameters, forwards[j], row_strikes[k], t_1[j]) : 0.;
+					double price_tol = std::fmin(Implied_Volatility::default_tolerance, price_tolerance * prices[cell]);
+					vol_results[cell] = Implied_Volatility::solve_from(prices[cell], forwards[j], row_strikes[k], t_1[j], discounts[j], call, guess, price_tol);
+					market_volatilities[cell] = vol_results[cell].volatility;
+				}
+			}
+			results[j] = fit(row_strikes, vols + j * n_strikes, n_strikes, forwards[j], t_1[j], warm, results[j].parameters);
+		}
+	}, 1);
+
+	calibrations++;
+	for (auto &r : results)
+	{
+		iterations += r.iterations;
+	}
+}
+
+
+/**
+* Function to fit alpha, rho and nu of one expiry by Levenberg-Marquardt in log(alpha), atanh(rho), log(nu). A cold
+* fit starts from the ATM alpha and the best rho and nu of a coarse grid. A step is accepted when it lowers the
+* squared error, after which the damping is divided by 3; a rejected step multiplies it by 4. The fit has converged
+* when an accepted step improves the squared error by less than the tolerance (relative), or moves the variables by
+* less than the tolerance, or when a step is rejected while the undamped (Gauss-Newton) step is below the square
+* root of the tolerance (no descent left at rounding level).
+* @param strikes const double pointer, denotes the strikes of the expiry.
+* @param vols const double pointer, denotes the quoted volatilities of the expiry.
+* @param n_strikes const size_t reference, denotes the number of strikes.
+* @param forward const double reference, denotes the forward rate.
+* @param t_1 const double reference, denotes the expiry (days).
+* @param warm const boolean reference, denotes whether to start from the given parameters.
+* @param start const Sabr_Parameters reference, denotes the starting parameters of a warm start.
+*/
+Sabr_Result Sabr_Calibration::fit(const double* strikes, const double* vols, const std::size_t& n_strikes, const double& forward, const double& t_1, const bool& warm, const Sabr_Parameters& start) const
+{
+	const double nan = std::numeric_limits<double>::quiet_NaN();
+	Sabr_Result result{ { nan, beta, nan, nan }, nan, 0, 0, Sabr_Invalid_Input };
+	if (!(forward > 0) || !(t_1 > 0) || !std::isfinite(forward) || !std::isfinite(t_1))
+	{
+		return result;
+	}
+
+	double atm_vol = 0;
+	double atm_distance = HUGE_VAL;
+	for (std::size_t k = 0; k < n_strikes; k++)
+	{
+		if (usable(strikes[k], vols[k]))
+		{
+			result.quotes++;
+			double distance = std::fabs(log(strikes[k] / forward));
+			if (distance < atm_distance)
+			{
+				atm_distance = distance;
+				atm_vol = vols[k];
+			}
+		}
+	}
+	if (result.quotes < 3)
+	{
+		return result;
+	}
+
+	double u[3];
+	if (warm && start.alpha > 0 && start.nu > 0 && std::fabs(start.rho) < 1)
+	{
+		u[0] = log(start.alpha);
+		u[1] = atanh(start.rho);
+		u[2] = log(start.nu);
+	}
+	else {
+		// The squared error is not convex in rho and nu for long expiries, so start from the best of a coarse grid
+		u[0] = log(atm_vol * pow(forward, 1 - beta));
+		u[1] = 0;
+		u[2] = log(0.3);
+		double best = HUGE_VAL;
+		for (const double& rho : cold_rhos)
+		{
+			for (const double& nu : cold_nus)
+			{
+				double cost = squared_error(Sabr_Parameters{ exp(u[0]), beta, rho, nu }, strikes, vols, n_strikes, forward, t_1, nullptr, nullptr);
+				if (cost < best)
+				{
+					best = cost;
+					u[1] = atanh(rho);
+					u[2] = log(nu);
+				}
+			}
+		}
+	}
+	clamp_variables(u);
+
+	Sabr_Parameters parameters = to_parameters(u, beta);
+	double gradient[3], hessian[6], step[3];
+	double cost = squared_error(parameters, strikes, vols, n_strikes, forward, t_1, gradient, hessian);
+	double lambda = 0.001;
+	result.status = Sabr_Max_Iterations;
+
+	while (result.iterations < max_iterations && std::isfinite(cost))
+	{
+		result.iterations++;
+		if (!damped_step(gradient, hessian, lambda, step))
+		{
+			lambda *= 4;
+			continue;
+		}
+
+		double trial_u[3] = { u[0] + step[0], u[1] + step[1], u[2] + step[2] };
+		clamp_variables(trial_u);
+		double step_size = 0;
+		for (int i = 0; i < 3; i++)
+		{
+			step_size = std::fmax(step_size, std::fabs(trial_u[i] - u[i]));
+		}
+
+		Sabr_Parameters trial = to_parameters(trial_u, beta);
+		double trial_cost = squared_error(trial, strikes, vols, n_strikes, forward, t_1, nullptr, nullptr);
+		if (trial_cost < cost)
+		{
+			bool converged = cost - trial_cost <= tolerance * cost || step_size <= tolerance;
+			for (int i = 0; i < 3; i++)
+			{
+				u[i] = trial_u[i];
+			}
+			parameters = trial;
+			cost = trial_cost;
+			if (converged)
+			{
+				result.status = Sabr_Converged;
+				break;
+			}
+			squared_error(parameters, strikes, vols, n_strikes, forward, t_1, gradient, hessian);
+			lambda = std::fmax(lambda / 3, 1e-15);
+		}
+		else {
+			// At the minimum to rounding level even the Gauss-Newton step is negligible
+			double newton[3];
+			if (damped_step(gradient, hessian, 0, newton) && std::fmax(std::fabs(newton[0]), std::fmax(std::fabs(newton[1]), std::fabs(newton[2]))) <= sqrt(tolerance))
+			{
+				result.status = Sabr_Converged;
+				break;
+			}
+			lambda *= 4;
+		}
+	}
+
+	result.parameters = parameters;
+	result.rms_error = sqrt(cost / result.quotes);
+	return result;
+}
+
+
+/**
+* Function to forget the previous parameters so the next calibration starts cold.
+*/
+void Sabr_Calibration::reset()
+{
+	results.clear();
+	forward_rates.clear();
+	expiries.clear();
+}
+
+
+/**
+* Function to return a printable description of a calibration status.
+* @param status const Sabr_Status reference, denotes the status.
+*/
+const char* Sabr_Calibration::get_status_name(const Sabr_Status& status)
+{
+	switch (status)
+	{
+	case Sabr_Converged: return "converged";
+	case Sabr_Max_Iterations: return "maximum iterations reached";
+	default: return "invalid input";
+	}
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include "Implied_Volatility.h"
+#include "Thread_Pool.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Sabr_Calibration.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Per expiry SABR smile calibration by Levenberg-Marquardt with analytic Jacobians, run in parallel.
+*
+* Each expiry is fitted independently: alpha, rho and nu minimise the squared error between the SABR volatility
+* of Hagan et al. (2002) and the quoted volatilities of its strikes, beta being fixed. The solve works on
+* log(alpha), atanh(rho) and log(nu) so every step stays admissible. The parameters of each expiry are kept and
+* start the next calibration of the same grid, which then typically needs two or three steps.
+*/
+
+enum Sabr_Status
+{
+	Sabr_Converged = 0, // step or improvement below the tolerance
+	Sabr_Max_Iterations = 1, // iteration cap reached, best parameters returned
+	Sabr_Invalid_Input = 2 // fewer than three usable quotes, or a non-positive forward or expiry, NaN parameters returned
+};
+
+struct Sabr_Parameters
+{
+	double alpha;
+	double beta;
+	double rho;
+	double nu;
+};
+
+struct Sabr_Result
+{
+	Sabr_Parameters parameters;
+	double rms_error; // root mean square error of the fitted volatilities
+	int iterations; // Levenberg-Marquardt steps tried
+	int quotes; // quotes used in the fit
+	Sabr_Status status;
+};
+
+
+class Sabr_Calibration
+{
+private:
+	// Attributes
+	double beta;
+	double tolerance;
+	int max_iterations;
+	std::vector<Sabr_Result> results; // one per expiry of the last calibration, warm start of the next
+	std::vector<double> forward_rates; // one per expiry of the last calibration
+	std::vector<double> expiries; // t_1 (days)
+	std::vector<double> market_volatilities; // [expiry][strike], implied from the prices by calibrate_prices
+	std::vector<Vol_Result> vol_results;
+
+	// Statistics
+	std::size_t calibrations{ 0 };
+	std::size_t warm_starts{ 0 }; // expiries started from the previous parameters
+	std::size_t iterations{ 0 };
+
+	// Methods
+	Sabr_Result fit(const double* strikes, const double* vols, const std::size_t& n_strikes, const double& forward, const double& t_1, const bool& warm, const Sabr_Parameters& start) const;
+	void calibrate_grid(const double* strikes, const double* vols, const double* prices, const double* forwards, const double* t_1, const double* discounts, const std::size_t& n_expiries, const std::size_t& n_strikes, const bool& call, Thread_Pool& pool);
+
+
+public:
+	static constexpr double default_tolerance = 0.000000000001; // relative improvement of the squared error, or step in the parameters
+	static constexpr int default_max_iterations = 100;
+
+	// Constructor & Destructor
+	Sabr_Calibration(const double& sabr_beta = 0.5, const double& tol = default_tolerance, const int& max_iter = default_max_iterations);
+	~Sabr_Calibration() {};
+
+	// Hagan et al. lognormal volatility, gradient (if given) filled with its derivatives in alpha, rho and nu
+	static double volatility(const Sabr_Parameters& parameters, const double& forward, const double& strike, const double& t_1, double* gradient = nullptr);
+
+	// Calibration of every expiry of a [expiry][strike] grid on the threads of the pool
+	void calibrate(const double* strikes, const double* vols, const double* forwards, const double* t_1, const std::size_t& n_expiries, const std::size_t& n_strikes, Thread_Pool& pool = Thread_Pool::shared());
+	void calibrate_prices(const double* strikes, const double* prices, const double* forwards, const double* t_1, const double* discounts, const std::size_t& n_expiries, const std::size_t& n_strikes, const bool& call, Thread_Pool& pool = Thread_Pool::shared());
+	void reset(); // the next calibration starts cold
+
+	// Getter Methods
+	std::size_t size() { return results.size(); };
+	const std::vector<Sabr_Result>& get_results() { return results; };
+	const Sabr_Parameters& get_parameters(const std::size_t& expiry) { return results.at(expiry).parameters; };
+	double get_volatility(const std::size_t& expiry, const double& strike) { return volatility(results.at(expiry).parameters, forward_rates.at(expiry), strike, expiries.at(expiry)); };
+	const std::vector<double>& get_market_volatilities() { return market_volatilities; };
+	const std::vector<Vol_Result>& get_vol_results() { return vol_results; }; // inversions of calibrate_prices
+	std::size_t get_calibrations() { return calibrations; };
+	std::size_t get_warm_starts() { return warm_starts; };
+	std::size_t get_iterations() { return iterations; };
+
+	// Reporting
+	static const char* get_status_name(const Sabr_Status& status);
+};
@@ -0,0 +1,363 @@
+#pragma once
+#include <cstddef>
+#include "Black_Formula.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Simd_Math.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Lane-generic exp, log, normal CDF and Black kernels for the SIMD pricers.
+*
+* Every function is a template over a lane type V (see Black_Simd_Sse2.cpp, Black_Simd_Avx2.cpp and
+* Black_Simd_Avx512.cpp) which supplies arithmetic operators, a broadcast constructor, load/store and
+* the free functions fmadd, vmin, vmax, vabs, vsqrt, cmp_lt, select, any_lane, round_nearest, pow2n and frexp_v.
+* V::Scalar is double or float, which is also the element type of the arrays the kernels read and write.
+* This header must only be included after the instruction set of the including file has been selected.
+*
+* Accuracy of the double lanes (measured against the scalar libm functions over the ranges used by the pricers):
+*   simd_exp        relative error < 4e-16 on [-708, 709] (Cephes Pade form).
+*   simd_log        absolute error < 2e-16 for positive normal arguments (Cephes rational form).
+*   simd_cdf_normal absolute error < 3e-16 on the whole real line, relative error < 1e-8 for
+*                   x > -37 (Hart 5666 rational form for |x| < 7.07 and a continued fraction
+*                   beyond, see G. West (2005) "Better approximations to cumulative normal functions").
+* Caplet and floorlet prices therefore agree with the erfc based scalar kernel to within 1e-16 absolute.
+* The float lanes evaluate the same forms (accurate far beyond single precision) with float rounding, so their
+* error is a few units of 2^-24 relative for exp and the CDF; see Mixed_Precision.h for the price error.
+*/
+
+
+/**
+* Range limits of the approximations for each scalar type.
+*/
+template<class Scalar> struct Simd_Limits;
+
+template<> struct Simd_Limits<double>
+{
+	static constexpr double exp_min = -708.39; // exp stays a normal number
+	static constexpr double exp_max = 709.78;
+	static constexpr double cdf_zero = 37.; // N(-x) is below the smallest normal number beyond
+};
+
+template<> struct Simd_Limits<float>
+{
+	static constexpr double exp_min = -87.3;
+	static constexpr double exp_max = 88.3; // keeps the reduced exponent n below 128
+	static constexpr double cdf_zero = 13.;
+};
+
+
+/**
+* Function to compute exp(x) in every lane.
+* Arguments are clamped (to [-708.39, 709.78] for double) so the result is always a normal number.
+*/
+template<class V> inline V simd_exp(V x)
+{
+	typedef Simd_Limits<typename V::Scalar> Limits;
+	x = vmin(vmax(x, V(Limits::exp_min)), V(Limits::exp_max));
+
+	// Reduce x = n ln(2) + r with |r| <= ln(2)/2 (ln(2) split in two for an exact product)
+	V n = round_nearest(x * V(1.4426950408889634073599));
+	x = fmadd(n, V(-6.93145751953125E-1), x);
+	x = fmadd(n, V(-1.42860682030941723212E-6), x);
+
+	// Pade approximant exp(r) = 1 + 2r P(r^2) / (Q(r^2) - r P(r^2))
+	V xx = x * x;
+	V px = x * fmadd(fmadd(V(1.26177193074810590878E-4), xx, V(3.02994407707441961300E-2)), xx, V(9.99999999999999999910E-1));
+	V qx = fmadd(fmadd(fmadd(V(3.00198505138664455042E-6), xx, V(2.52448340349684104192E-3)), xx, V(2.27265548208155028766E-1)), xx, V(2.00000000000000000009E0));
+	x = px / (qx - px);
+	x = fmadd(x, V(2.0), V(1.0));
+
+	return x * pow2n(n);
+}
+
+
+/**
+* Function to compute the natural logarithm in every lane. Arguments must be positive normal numbers.
+*/
+template<class V> inline V simd_log(V x)
+{
+	V e;
+	V m = frexp_v(x, e); // x = m 2^e with m in [0.5, 1)
+
+	// Shift m into [sqrt(1/2), sqrt(2)) and work with m-1
+	auto small = cmp_lt(m, V(0.70710678118654752440));
+	e = e - select(small, V(1.0), V(0.0));
+	m = select(small, m + m, m) - V(1.0);
+
+	V z = m * m;
+	V p = fmadd(fmadd(fmadd(fmadd(fmadd(V(1.01875663804580931796E-4), m, V(4.97494994976747001425E-1)), m, V(4.70579119878881725854E0)), m, V(1.44989225341610930846E1)), m, V(1.79368678507819816313E1)), m, V(7.70838733755885391666E0));
+	V q = fmadd(fmadd(fmadd(fmadd(m + V(1.12873587189167450590E1), m, V(4.52279145837532221105E1)), m, V(8.29875266912776603211E1)), m, V(7.11544750618563894466E1)), m, V(2.31251620126765340583E1));
+	V y = m * (z * p / q);
+
+	// Add back the exponent with ln(2) split in two
+	y = fmadd(e, V(-2.121944400546905827679e-4), y);
+	y = fmadd(z, V(-0.5), y);
+	x = m + y;
+	return fmadd(e, V(0.693359375), x);
+}
+
+
+/**
+* Function to compute the lower tail N(-|x|) of the standard normal distribution in every lane.
+*/
+template<class V> inline V simd_normal_tail(const V& x)
+{
+	V a = vabs(x);
+	V gauss = simd_exp(V(-0.5) * a * a);
+
+	// Rational approximation for |x| < 7.07
+	V num = fmadd(fmadd(fmadd(fmadd(fmadd(fmadd(V(3.52624965998911E-02), a, V(0.700383064443688)), a, V(6.37396220353165)), a, V(33.912866078383)), a, V(112.079291497871)), a, V(221.213596169931)), a, V(220.206867912376));
+	V den = fmadd(fmadd(fmadd(fmadd(fmadd(fmadd(fmadd(V(8.83883476483184E-02), a, V(1.75566716318264)), a, V(16.064177579207)), a, V(86.7807322029461)), a, V(296.564248779674)), a, V(637.333633378831)), a, V(793.826512519948)), a, V(440.413735824752));
+	V tail = gauss * num / den;
+
+	// Continued fraction for the far tail, only evaluated when a lane needs it
+	auto far = cmp_lt(V(7.07106781186547), a);
+	if (any_lane(far))
+	{
+		V frac = a + V(0.65);
+		frac = a + V(4.0) / frac;
+		frac = a + V(3.0) / frac;
+		frac = a + V(2.0) / frac;
+		frac = a + V(1.0) / frac;
+		tail = select(far, gauss / (frac * V(2.506628274631)), tail);
+		tail = select(cmp_lt(V(Simd_Limits<typename V::Scalar>::cdf_zero), a), V(0.0), tail);
+	}
+	return tail;
+}
+
+
+/**
+* Function to compute the CDF of the standard normal distribution in every lane.
+*/
+template<class V> inline V simd_cdf_normal(V x)
+{
+	V tail = simd_normal_tail(x);
+	return select(cmp_lt(V(0.0), x), V(1.0) - tail, tail);
+}
+
+
+/**
+* Function to compute N(x) and N(-x) in every lane from one evaluation of the tail N(-|x|), the smaller of
+* the two, so each is as accurate as simd_cdf_normal and neither is found by cancellation.
+* @param x const V reference, denotes the arguments.
+* @param lower V reference, set to N(x).
+* @param upper V reference, set to N(-x).
+*/
+template<class V> inline void simd_cdf_normal_pair(const V& x, V& lower, V& upper)
+{
+	V tail = simd_normal_tail(x);
+	V other = V(1.0) - tail;
+	auto positive = cmp_lt(V(0.0), x);
+	lower = select(positive, other, tail);
+	upper = select(positive, tail, other);
+}
+
+
+/**
+* Normal policy of black_value (see Black_Formula.h) evaluating every lane with the approximations above.
+*/
+struct Simd_Normal
+{
+	template<class V> static V log(const V& x) { return simd_log(x); };
+	template<class V> static V cdf(const V& x) { return simd_cdf_normal(x); };
+	template<class V> static void cdf_pair(const V& x, V& lower, V& upper) { simd_cdf_normal_pair(x, lower, upper); };
+};
+
+
+/**
+* Function to price up to 64 optionlets (a whole number of lane-widths) with Black's formula
+* (see Black_Formula.h). Arguments as for Optionlet_Batch::caplet_prices.
+* The work is split into three short loops (d1/d2, normal CDFs, prices) rather than one long
+* dependency chain per lane-width, so the CPU can overlap consecutive lane-widths.
+*/
+template<class V> inline void simd_black_tile(const typename V::Scalar* strike, const typename V::Scalar* vol, const typename V::Scalar* forward, const typename V::Scalar* t_1, const typename V::Scalar* discount, typename V::Scalar* price, const std::size_t& n, const bool& call)
+{
+	const std::size_t width = V::width;
+	typename V::Scalar d[128]; // d1 in the first half, d2 in the second half (negated for floorlets)
+	double sign = call ? 1. : -1.;
+
+	for (std::size_t i = 0; i < n; i += width)
+	{
+		V std_dev = V::load(vol + i) * vsqrt(V::load(t_1 + i) * V(1. / 365.));
+		V d1, d2;
+		black_d<V, Simd_Normal>(V::load(forward + i), V::load(strike + i), std_dev, d1, d2);
+		(V(sign) * d1).store(d + i);
+		(V(sign) * d2).store(d + 64 + i);
+	}
+
+	for (std::size_t i = 0; i < n; i += width)
+	{
+		simd_cdf_normal(V::load(d + i)).store(d + i);
+		simd_cdf_normal(V::load(d + 64 + i)).store(d + 64 + i);
+	}
+
+	for (std::size_t i = 0; i < n; i += width)
+	{
+		(V::load(discount + i) * black_combine(V::load(forward + i), V::load(strike + i), V::load(d + i), V::load(d + 64 + i), call)).store(price + i);
+	}
+}
+
+
+/**
+* Function to price n optionlets, 64 at a time. The remainder is padded with harmless
+* values up to a whole number of lane-widths and only the valid results are written back.
+*/
+template<class V> inline void simd_black_prices(const typename V::Scalar* strike, const typename V::Scalar* vol, const typename V::Scalar* forward, const typename V::Scalar* t_1, const typename V::Scalar* discount, typename V::Scalar* price, const std::size_t& n, const bool& call)
+{
+	typedef typename V::Scalar Scalar;
+	const std::size_t width = V::width;
+	std::size_t i = 0;
+	for (; i + 64 <= n; i += 64)
+	{
+		simd_black_tile<V>(strike + i, vol + i, forward + i, t_1 + i, discount + i, price + i, 64, call);
+	}
+
+	std::size_t full = ((n - i) / width) * width;
+	if (full > 0)
+	{
+		simd_black_tile<V>(strike + i, vol + i, forward + i, t_1 + i, discount + i, price + i, full, call);
+		i += full;
+	}
+
+	if (i < n)
+	{
+		Scalar pad[5][V::width];
+		Scalar out[V::width];
+		for (std::size_t j = 0; j < width; j++)
+		{
+			bool valid = i + j < n;
+			pad[0][j] = valid ? strike[i + j] : 1.;
+			pad[1][j] = valid ? vol[i + j] : 1.;
+			pad[2][j] = valid ? forward[i + j] : 1.;
+			pad[3][j] = valid ? t_1[i + j] : 365.;
+			pad[4][j] = valid ? discount[i + j] : 1.;
+		}
+		simd_black_tile<V>(pad[0], pad[1], pad[2], pad[3], pad[4], out, width, call);
+		for (std::size_t j = 0; i + j < n; j++)
+		{
+			price[i + j] = out[j];
+		}
+	}
+}
+
+
+/**
+* Function to value up to 64 optionlets (a whole number of lane-widths) as caplets, floorlets and
+* digital caplets/floorlets at once. d1 and d2 are computed once per optionlet, and one tail evaluation
+* of each (see simd_cdf_normal_pair) gives both N(d) and N(-d), so the floorlets are priced from N(-d1)
+* and N(-d2) directly: put-call parity C - D (F - K) would cancel out of the money and can leave a
+* negative floorlet.
+* Arguments as for Black_Simd::optionlet_values.
+*/
+template<class V> inline void simd_black_values_tile(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n)
+{
+	const std::size_t width = V::width;
+	double d[256]; // N(d1), N(d2), N(-d1) and N(-d2), 64 each
+
+	for (std::size_t i = 0; i < n; i += width)
+	{
+		V std_dev = V::load(vol + i) * vsqrt(V::load(t_1 + i) * V(1. / 365.));
+		V d1, d2;
+		black_d<V, Simd_Normal>(V::load(forward + i), V::load(strike + i), std_dev, d1, d2);
+		d1.store(d + i);
+		d2.store(d + 64 + i);
+	}
+
+	for (std::size_t i = 0; i < n; i += width)
+	{
+		V n_d1, n_d2, n_minus_d1, n_minus_d2;
+		simd_cdf_normal_pair(V::load(d + i), n_d1, n_minus_d1);
+		simd_cdf_normal_pair(V::load(d + 64 + i), n_d2, n_minus_d2);
+		n_d1.store(d + i);
+		n_d2.store(d + 64 + i);
+		n_minus_d1.store(d + 128 + i);
+		n_minus_d2.store(d + 192 + i);
+	}
+
+	for (std::size_t i = 0; i < n; i += width)
+	{
+		V df = V::load(discount + i);
+		V f = V::load(forward + i);
+		V k = V::load(strike + i);
+		(df * black_combine(f, k, V::load(d + i), V::load(d + 64 + i), true)).store(cap + i);
+		(df * black_combine(f, k, V::load(d + 128 + i), V::load(d + 192 + i), false)).store(floor + i);
+		(df * V::load(d + 64 + i)).store(digital_cap + i);
+		(df * V::load(d + 192 + i)).store(digital_floor + i);
+	}
+}
+
+
+/**
+* Function to value n optionlets, 64 at a time (see simd_black_values_tile). The remainder is
+* padded as in simd_black_prices and only the valid results are written back.
+*/
+template<class V> inline void simd_black_values(const double* strike, const double* vol, const double* forward, const double* t_1, const double* discount, double* cap, double* floor, double* digital_cap, double* digital_floor, const std::size_t& n)
+{
+	const std::size_t width = V::width;
+	std::size_t i = 0;
+	for (; i + 64 <= n; i += 64)
+	{
+		simd_black_values_tile<V>(strike + i, vol + i, forward + i, t_1 + i, discount + i, cap + i, floor + i, digital_cap + i, digital_floor + i, 64);
+	}
+
+	std::size_t full = ((n - i) / width) * width;
+	if (full > 0)
+	{
+		simd_black_values_tile<V>(strike + i, vol + i, forward + i, t_1 + i, discount + i, cap + i, floor + i, digital_cap + i, digital_floor + i, full);
+		i += full;
+	}
+
+	if (i < n)
+	{
+		double pad[5][V::width];
+		double out[4][V::width];
+		for (std::size_t j = 0; j < width; j++)
+		{
+			bool valid = i + j < n;
+			pad[0][j] = valid ? strike[i + j] : 1.;
+			pad[1][j] = valid ? vol[i + j] : 1.;
+			pad[2][j] = valid ? forward[i + j] : 1.;
+			pad[3][j] = valid ? t_1[i + j] : 365.;
+			pad[4][j] = valid ? discount[i + j] : 1.;
+		}
+		simd_black_values_tile<V>(pad[0], pad[1], pad[2], pad[3], pad[4], out[0], out[1], out[2], out[3], width);
+		for (std::size_t j = 0; i + j < n; j++)
+		{
+			cap[i + j] = out[0][j];
+			floor[i + j] = out[1][j];
+			digital_cap[i + j] = out[2][j];
+			digital_floor[i + j] = out[3][j];
+		}
+	}
+}
+
+
+/**
+* Function to compute exp(x[i]) for n values, a lane-width at a time (see simd_exp).
+* The remainder is padded with zeros and only the valid results are written back.
+*/
+template<class V> inline void simd_exp_values(const typename V::Scalar* x, typename V::Scalar* result, const std::size_t& n)
+{
+	const std::size_t width = V::width;
+	std::size_t i = 0;
+	for (; i + width <= n; i += width)
+	{
+		simd_exp(V::load(x + i)).store(result + i);
+	}
+
+	if (i < n)
+	{
+		typename V::Scalar pad[V::width];
+		for (std::size_t j = 0; j < width; j++)
+		{
+			pad[j] = i + j < n ? x[i + j] : 0;
+		}
+		simd_exp(V::load(pad)).store(pad);
+		for (std::size_t j = 0; i + j < n; j++)
+		{
+			result[i + j] = pad[j];
+		}
+	}
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+
+/**
+* Project:    Project 1
+* Filename:   Spsc_Ring.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Lock-free single-producer/single-consumer ring buffer for passing market updates between threads.
+*
+* Exactly one thread may push and exactly one (other) thread may pop. The two indices live on separate
+* cache lines and each side keeps a cached copy of the other side's index, so in steady state a push or
+* pop touches no cache line owned by the other thread unless the ring looks full (or empty).
+*/
+template<class T> class Spsc_Ring
+{
+private:
+	static const std::size_t cache_line = 64;
+
+	// Attributes
+	std::unique_ptr<T[]> slots;
+	std::size_t mask; // capacity - 1, capacity a power of two
+	alignas(cache_line) std::atomic<std::size_t> head{ 0 }; // next slot to pop, written by the consumer
+	std::size_t cached_tail{ 0 }; // consumer's view of tail
+	alignas(cache_line) std::atomic<std::size_t> tail{ 0 }; // next slot to push, written by the producer
+	std::size_t cached_head{ 0 }; // producer's view of head (the class is cache line aligned, so nothing follows on this line)
+
+
+public:
+	/**
+	* Constructor for a ring holding at least the requested number of items (rounded up to a power of two).
+	* @param capacity const size_t reference, denotes the minimum number of items the ring can hold.
+	*/
+	Spsc_Ring(const std::size_t& capacity)
+	{
+		std::size_t size = 2;
+		while (size < capacity)
+		{
+			size *= 2;
+		}
+		slots.reset(new T[size]);
+		mask = size - 1;
+	}
+	~Spsc_Ring() {};
+	Spsc_Ring(const Spsc_Ring&) = delete;
+	Spsc_Ring& operator=(const Spsc_Ring&) = delete;
+
+	/**
+	* Function to append an item (producer thread only).
+	* @param item const T reference, denotes the item.
+	* Returns false, without blocking, if the ring is full.
+	*/
+	bool try_push(const T& item)
+	{
+		std::size_t t = tail.load(std::memory_order_relaxed);
+		if (t - cached_head > mask)
+		{
+			cached_head = head.load(std::memory_order_acquire);
+			if (t - cached_head > mask)
+			{
+				return false;
+			}
+		}
+		slots[t & mask] = item;
+		tail.store(t + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	* Function to remove the oldest item (consumer thread only).
+	* @param item T reference, filled with the item.
+	* Returns false, without blocking, if the ring is empty.
+	*/
+	bool try_pop(T& item)
+	{
+		std::size_t h = head.load(std::memory_order_relaxed);
+		if (h == cached_tail)
+		{
+			cached_tail = tail.load(std::memory_order_acquire);
+			if (h == cached_tail)
+			{
+				return false;
+			}
+		}
+		item = slots[h & mask];
+		head.store(h + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	* Function to remove up to max_items of the oldest items at once (consumer thread only).
+	* @param items T pointer, denotes the output array.
+	* @param max_items const size_t reference, denotes the size of the output array.
+	* Returns the number of items removed.
+	*/
+	std::size_t pop_many(T* items, const std::size_t& max_items)
+	{
+		std::size_t h = head.load(std::memory_order_relaxed);
+		cached_tail = tail.load(std::memory_order_acquire);
+		std::size_t n = cached_tail - h < max_items ? cached_tail - h : max_items;
+		for (std::size_t i = 0; i < n; i++)
+		{
+			items[i] = slots[(h + i) & mask];
+		}
+		head.store(h + n, std::memory_order_release);
+		return n;
+	}
+
+	// Getter Methods
+	std::size_t capacity() { return mask + 1; };
+	bool empty() { return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire); };
+};
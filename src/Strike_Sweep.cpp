@@ -0,0 +1,129 @@
+#include "Strike_Sweep.h"
+#include "Optionlet_Batch.h"
+#include <iostream>
+
+
+/**
+* Project:    Project 1
+* Filename:   Strike_Sweep.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Prices caps and floors for every combination of strike and volatility shift off one curve.
+*/
+
+
+/**
+* Constructor for a sweep of caps and floors over a list of strikes and additive volatility shifts.
+* The forward rates and discount factors are computed once from the base curve, then every
+* (strike, shift) scenario is priced on the threads of the pool straight into the result matrices,
+* with the caplets and floorlets of a scenario sharing one Black evaluation (see Rate_Cap_Floor.h).
+* Each scenario applies one strike to every optionlet, as in Scenario 1 of main_P1.cpp.
+* @param strikes const vector double reference, denotes the strikes to sweep.
+* @param shifts const vector double reference, denotes the additive shifts applied to every volatility.
+* @param volatilities const vector double reference, denotes the base volatility of each optionlet.
+* @param rates const vector double reference, denotes the interest rates at each discrete time interval t_i.
+* @param time_of_rates const vector usigned int reference, denotes the times at which each of the rates occurs.
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param pool Thread_Pool reference, denotes the threads used for pricing.
+*/
+Strike_Sweep::Strike_Sweep(const std::vector<double>& strikes, const std::vector<double>& shifts, const std::vector<double>& volatilities, const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const bool& continuous, Thread_Pool& pool)
+{
+	n_strikes = strikes.size();
+	n_shifts = shifts.size();
+	n_optionlets = volatilities.size();
+
+	if (rates.size() != n_optionlets + 1 || time_of_rates.size() != n_optionlets + 1)
+	{
+		throw 3; // Check that for N options, N + 1 rates and times, as well as, N volatilities have been given.
+	}
+	for (auto &k : strikes)
+	{
+		if (k < 0.)
+		{
+			throw 2;
+		}
+	}
+	for (auto &v : volatilities)
+	{
+		for (auto &s : shifts)
+		{
+			if (v + s < 0.)
+			{
+				throw 2; // Shifted volatilities must stay non-negative.
+			}
+		}
+	}
+
+	sweep_strikes = strikes;
+	vol_shifts = shifts;
+
+	// Curve quantities shared by every scenario
+	forward_rates.assign(n_optionlets, 0);
+	std::vector<double> expiries(n_optionlets, 0);
+	std::vector<double> discount_factors(n_optionlets, 0);
+	Optionlet_Batch::forward_curve(rates.data(), time_of_rates.data(), rates.size(), continuous, 4, forward_rates.data(), expiries.data(), discount_factors.data());
+
+	std::size_t n_scenarios = n_strikes * n_shifts;
+	cap_prices.assign(n_scenarios * n_optionlets, 0);
+	floor_prices.assign(n_scenarios * n_optionlets, 0);
+	cap_totals.assign(n_scenarios, 0);
+	floor_totals.assign(n_scenarios, 0);
+
+	pool.parallel_for(n_scenarios, [&](std::size_t begin, std::size_t end)
+	{
+		std::vector<double> strike_row(n_optionlets);
+		std::vector<double> vol_row(n_optionlets);
+		std::vector<double> digital_caps(n_optionlets);
+		std::vector<double> digital_floors(n_optionlets);
+		for (std::size_t scenario = begin; scenario < end; scenario++)
+		{
+			double k = sweep_strikes[scenario / n_shifts];
+			double shift = vol_shifts[scenario % n_shifts];
+			for (std::size_t i = 0; i < n_optionlets; i++)
+			{
+				strike_row[i] = k;
+				vol_row[i] = volatilities[i] + shift;
+			}
+
+			double* caps = &cap_prices[scenario * n_optionlets];
+			double* floors = &floor_prices[scenario * n_optionlets];
+			Optionlet_Batch::optionlet_values(strike_row.data(), vol_row.data(), forward_rates.data(), expiries.data(), discount_factors.data(), caps, floors, digital_caps.data(), digital_floors.data(), n_optionlets);
+
+			double cap_total = 0;
+			double floor_total = 0;
+			for (std::size_t i = 0; i < n_optionlets; i++)
+			{
+				cap_total += caps[i];
+				floor_total += floors[i];
+			}
+			cap_totals[scenario] = cap_total;
+			floor_totals[scenario] = floor_total;
+		}
+	}, 1);
+}
+
+
+/**
+* Function to print the caplet and floorlet prices of one scenario to the console.
+* @param strike_index const size_t reference, denotes the position of the strike in the sweep.
+* @param shift_index const size_t reference, denotes the position of the volatility shift in the sweep.
+*/
+void Strike_Sweep::print_prices(const std::size_t& strike_index, const std::size_t& shift_index)
+{
+	std::size_t scenario = strike_index * n_shifts + shift_index;
+
+	std::cout << "Cap Prices: ";
+	for (std::size_t i = 0; i < n_optionlets; i++)
+	{
+		std::cout << cap_prices.at(scenario * n_optionlets + i) << " ";
+	}
+	std::cout << std::endl;
+
+	std::cout << "Floor Prices: ";
+	for (std::size_t i = 0; i < n_optionlets; i++)
+	{
+		std::cout << floor_prices.at(scenario * n_optionlets + i) << " ";
+	}
+	std::cout << std::endl;
+	return;
+}
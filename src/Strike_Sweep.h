@@ -0,0 +1,47 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include "Thread_Pool.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Strike_Sweep.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Prices caps and floors for every combination of strike and volatility shift off one curve.
+*/
+class Strike_Sweep
+{
+private:
+	// Attributes
+	std::size_t n_strikes;
+	std::size_t n_shifts;
+	std::size_t n_optionlets;
+	std::vector<double> sweep_strikes;
+	std::vector<double> vol_shifts;
+	std::vector<double> forward_rates; // shared by every scenario
+	std::vector<double> cap_prices; // [strike][shift][optionlet]
+	std::vector<double> floor_prices; // [strike][shift][optionlet]
+	std::vector<double> cap_totals; // [strike][shift]
+	std::vector<double> floor_totals; // [strike][shift]
+
+
+public:
+	// Constructor & Destructor
+	Strike_Sweep(const std::vector<double>& strikes, const std::vector<double>& shifts, const std::vector<double>& volatilities, const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const bool& continuous, Thread_Pool& pool = Thread_Pool::shared());
+	~Strike_Sweep() {};
+
+	// Getter & Print Methods
+	const std::vector<double>& get_cap_prices() { return cap_prices; };
+	const std::vector<double>& get_floor_prices() { return floor_prices; };
+	const std::vector<double>& get_cap_totals() { return cap_totals; };
+	const std::vector<double>& get_floor_totals() { return floor_totals; };
+	const std::vector<double>& get_forward_rates() { return forward_rates; };
+	double get_cap_price(const std::size_t& strike_index, const std::size_t& shift_index, const std::size_t& optionlet) { return cap_prices.at((strike_index * n_shifts + shift_index) * n_optionlets + optionlet); };
+	double get_floor_price(const std::size_t& strike_index, const std::size_t& shift_index, const std::size_t& optionlet) { return floor_prices.at((strike_index * n_shifts + shift_index) * n_optionlets + optionlet); };
+	double get_cap_total(const std::size_t& strike_index, const std::size_t& shift_index) { return cap_totals.at(strike_index * n_shifts + shift_index); };
+	double get_floor_total(const std::size_t& strike_index, const std::size_t& shift_index) { return floor_totals.at(strike_index * n_shifts + shift_index); };
+	std::size_t get_optionlet_count() { return n_optionlets; };
+	void print_prices(const std::size_t& strike_index, const std::size_t& shift_index);
+};
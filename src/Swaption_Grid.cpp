@@ -0,0 +1,128 @@
+#include "Swaption_Grid.h"
+#include "Black_Simd.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Swaption_Grid.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    European payer and receiver swaptions on every (expiry, tenor) point of a grid, priced off one curve.
+*/
+
+
+/**
+* Constructor for a swaption grid on a curve, building the annuity and forward swap rate of every point.
+* @param curve const Discount_Curve reference, denotes the curve whose pillars are the payment dates of the swaps.
+* @param expiry_pillar_indices const vector size_t reference, denotes the pillar at which each expiry's swap starts.
+* @param tenor_periods const vector size_t reference, denotes the number of periods of each tenor's swap.
+*/
+Swaption_Grid::Swaption_Grid(const Discount_Curve& curve, const std::vector<std::size_t>& expiry_pillar_indices, const std::vector<std::size_t>& tenor_periods)
+{
+	if (expiry_pillar_indices.empty() || tenor_periods.empty())
+	{
+		throw 3;
+	}
+	for (auto &m : tenor_periods)
+	{
+		if (m == 0)
+		{
+			throw 2; // Every swap needs at least one period.
+		}
+	}
+	expiry_pillars = expiry_pillar_indices;
+	tenors = tenor_periods;
+	set_curve(curve);
+}
+
+
+/**
+* Function to rebuild the annuities and forward swap rates of the grid from a new curve with one pass over its
+* pillars for the prefix sums and one subtraction per grid point. The longest swap of the grid must end on or
+* before the last pillar.
+* @param curve const Discount_Curve reference, denotes the curve.
+*/
+void Swaption_Grid::set_curve(const Discount_Curve& curve)
+{
+	std::size_t n_pillars = curve.size();
+	for (auto &s : expiry_pillars)
+	{
+		for (auto &m : tenors)
+		{
+			if (s + m >= n_pillars)
+			{
+				throw 3; // The curve must cover every swap of the grid.
+			}
+		}
+	}
+
+	pillar_times.resize(n_pillars);
+	pillar_discounts.resize(n_pillars);
+	annuity_sums.resize(n_pillars);
+	annuity_sums[0] = 0;
+	for (std::size_t i = 0; i < n_pillars; i++)
+	{
+		pillar_times[i] = curve.get_time(i);
+		pillar_discounts[i] = curve.get_pillar_discount_factor(i);
+		if (i > 0)
+		{
+			annuity_sums[i] = annuity_sums[i - 1] + (pillar_times[i] - pillar_times[i - 1]) / 365. * pillar_discounts[i];
+		}
+	}
+
+	std::size_t n_tenors = tenors.size();
+	annuities.resize(expiry_pillars.size() * n_tenors);
+	swap_rates.resize(annuities.size());
+	expiries.resize(annuities.size());
+	for (std::size_t j = 0; j < expiry_pillars.size(); j++)
+	{
+		std::size_t s = expiry_pillars[j];
+		double* row_annuities = &annuities[j * n_tenors];
+		double* row_rates = &swap_rates[j * n_tenors];
+		double* row_expiries = &expiries[j * n_tenors];
+		for (std::size_t k = 0; k < n_tenors; k++)
+		{
+			std::size_t e = s + tenors[k];
+			row_annuities[k] = annuity_sums[e] - annuity_sums[s];
+			row_rates[k] = (pillar_discounts[s] - pillar_discounts[e]) / row_annuities[k];
+			row_expiries[k] = pillar_times[s];
+		}
+	}
+}
+
+
+/**
+* Function to price every swaption of the grid under Black in one vectorised pass.
+* @param strikes const double pointer, denotes the fixed rate of each swaption, [expiry][tenor].
+* @param vols const double pointer, denotes the Black volatility of each swap rate, [expiry][tenor].
+* @param payer const boolean reference, denotes whether the swaptions are payer(true) or receiver(false).
+* @param prices double pointer, denotes the output array of swaption prices (per unit notional), [expiry][tenor].
+*/
+void Swaption_Grid::price(const double* strikes, const double* vols, const bool& payer, double* prices) const
+{
+	if (payer)
+	{
+		Black_Simd::caplet_prices(strikes, vols, swap_rates.data(), expiries.data(), annuities.data(), prices, size());
+	}
+	else {
+		Black_Simd::floorlet_prices(strikes, vols, swap_rates.data(), expiries.data(), annuities.data(), prices, size());
+	}
+}
+
+
+/**
+* Function to return the annuity of one grid point summed period by period, as a check of the prefix sums
+* (they agree to within a few ulps of the annuity up to the start of the swap).
+* @param expiry const size_t reference, denotes the expiry index in the grid.
+* @param tenor const size_t reference, denotes the tenor index in the grid.
+*/
+double Swaption_Grid::direct_annuity(const std::size_t& expiry, const std::size_t& tenor) const
+{
+	std::size_t s = expiry_pillars.at(expiry);
+	double annuity = 0;
+	for (std::size_t i = s; i < s + tenors.at(tenor); i++)
+	{
+		annuity += (pillar_times[i + 1] - pillar_times[i]) / 365. * pillar_discounts[i + 1];
+	}
+	return annuity;
+}
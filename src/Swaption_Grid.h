@@ -0,0 +1,56 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include "Discount_Curve.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Swaption_Grid.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    European payer and receiver swaptions on every (expiry, tenor) point of a grid, priced off one curve.
+*
+* The fixed leg of a swap pays at every pillar of the curve, so a swap starting at pillar s with m periods has
+* annuity A = sum of tau_i P(t_{i+1}) for i = s .. s+m-1, tau_i = (t_{i+1} - t_i)/365, and forward swap rate
+* S = (P(t_s) - P(t_{s+m})) / A. With the prefix sums C_k = sum of tau_i P(t_{i+1}) for i < k every annuity is
+* C_{s+m} - C_s, so the whole grid costs one pass over the curve plus one subtraction per point, instead of m
+* terms per point. Under Black a payer swaption expiring at t_s is A Black_call(S, K, vol, t_s), a caplet with
+* discount A, so the grid is priced in one call to the kernels of Black_Simd.h. Grids are laid out [expiry][tenor].
+*/
+class Swaption_Grid
+{
+private:
+	// Attributes: grid
+	std::vector<std::size_t> expiry_pillars; // pillar at which each expiry's swap starts
+	std::vector<std::size_t> tenors; // number of periods of each tenor's swap
+
+	// Attributes: curve (one entry per pillar)
+	std::vector<double> pillar_times; // days
+	std::vector<double> pillar_discounts;
+	std::vector<double> annuity_sums; // prefix sums C_k
+
+	// Attributes: one entry per grid point
+	std::vector<double> annuities;
+	std::vector<double> swap_rates;
+	std::vector<double> expiries; // t_s (days), repeated along each row for the kernels
+
+
+public:
+	// Constructors & Destructor
+	Swaption_Grid(const Discount_Curve& curve, const std::vector<std::size_t>& expiry_pillar_indices, const std::vector<std::size_t>& tenor_periods);
+	~Swaption_Grid() {};
+
+	// Methods
+	void set_curve(const Discount_Curve& curve); // rebuilds every annuity and swap rate, the grid is unchanged
+	void price(const double* strikes, const double* vols, const bool& payer, double* prices) const; // [expiry][tenor] arrays of size()
+	double direct_annuity(const std::size_t& expiry, const std::size_t& tenor) const; // summed term by term, for checking the grid
+
+	// Getter Methods
+	std::size_t size() const { return annuities.size(); };
+	std::size_t expiry_count() const { return expiry_pillars.size(); };
+	std::size_t tenor_count() const { return tenors.size(); };
+	const std::vector<double>& get_annuities() const { return annuities; };
+	const std::vector<double>& get_swap_rates() const { return swap_rates; };
+	const std::vector<double>& get_expiries() const { return expiries; };
+};
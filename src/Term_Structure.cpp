@@ -37,7 +37,7 @@ Term_Structure::Term_Structure(Bond& zcb_1, const unsigned int& expiry_1, Bond&
 	float principal_1 = zcb_1.get_principal();
 	float principal_2 = zcb_2.get_principal();
 
-	if (abs(principal_1 - principal_2)>= 0.001)
+	if (fabs(principal_1 - principal_2)>= 0.001)
 	{
 		// Normalise the principals
 		p_1 = p_1 / principal_1;
@@ -77,10 +77,8 @@ Term_Structure::Term_Structure(const double& r_1, const unsigned int& time_of_ra
 
 
 	// convert rates to ZCB prices
-	double T_1 = time_of_rate_1 / double(365);
-	price_1 = exp(-1 *r_1*T_1);
-	double T_2 = time_of_rate_2 / double(365);
-	price_2 = exp(-1 * r_2*T_2);
+	price_1 = zcb_price(r_1, time_of_rate_1);
+	price_2 = zcb_price(r_2, time_of_rate_2);
 }
 
 /**
@@ -94,36 +92,4 @@ Term_Structure::Term_Structure()
 	price_2 = 0;
 	t_1 = 0;
 	t_2 = 0;
-	continuous_forward_rate = 0;
-	discrete_forward_rate = 0;
-}
-
-/**
-* Function to calculate the forward rates based on the two consecutive zero rates.
-*/
-void Term_Structure::calculate_rates()
-{
-	// For more details on this calculation- see accompanying pdf.
-	int n_compound_increments = int(((t_2 - t_1)*compounding_frequency) / 365.); 
-	discrete_forward_rate = (pow((price_1 / price_2), 1. / n_compound_increments)-1)*compounding_frequency; // f=n((p_1/p_2)^(1/n_compounds)-1)
-	continuous_forward_rate = log(price_1 / price_2) / double((t_2 - t_1)/365.);
-	return;
-}
-
-/**
-* Getter function to return forward rate based on continuous compounding.
-*/
-double Term_Structure::get_continuous_fwd_rate()
-{
-	calculate_rates();
-	return continuous_forward_rate;
-}
-
-/**
-* Getter function to return forward rate based on discrete compounding.
-*/
-double Term_Structure::get_discrete_fwd_rate()
-{
-	calculate_rates();
-	return discrete_forward_rate;
 }
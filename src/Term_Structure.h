@@ -1,5 +1,6 @@
 #pragma once
 #include "Bond.h"
+#include "Compounding.h"
 
 /**
 * Project:    Project 1
@@ -18,12 +19,6 @@ protected:
 	double price_2;
 	unsigned int t_1;
 	unsigned int t_2;
-	double continuous_forward_rate; //Continuous Compounding
-	double discrete_forward_rate; // Nominal Rate Compounding
-
-	//Methods
-	void calculate_rates();
-
 
 public:
 
@@ -33,9 +28,10 @@ public:
 	Term_Structure();
 	~Term_Structure() {};
 	
-	//Methods
-	double get_continuous_fwd_rate();
-	double get_discrete_fwd_rate();
+	//Methods (each convention is only computed when asked for)
+	template<class Compounding> double get_fwd_rate() { return Compounding::forward_rate(price_1, price_2, t_1, t_2, compounding_frequency); };
+	double get_continuous_fwd_rate() { return get_fwd_rate<Continuous_Compounding>(); };
+	double get_discrete_fwd_rate() { return get_fwd_rate<Discrete_Compounding>(); };
 	double get_price_2() { return price_2; };
 	double get_price_1() { return price_1; };
 	unsigned int get_t1() { return t_1; };
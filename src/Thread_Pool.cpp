@@ -0,0 +1,185 @@
+#include "Thread_Pool.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Thread_Pool.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Persistent pool of worker threads for splitting independent pricing work across cores.
+*/
+
+
+namespace
+{
+	// Set on pool threads (and on the caller while it helps), so nested parallel_for calls run serially.
+	thread_local bool inside_pool = false;
+}
+
+
+/**
+* Constructor for a pool of worker threads. The thread calling parallel_for also does work,
+* so n_threads-1 workers are started.
+* @param n_threads const unsigned int reference, denotes the total number of threads (0 for one per hardware thread).
+*/
+Thread_Pool::Thread_Pool(const unsigned int& n_threads)
+{
+	unsigned int n = n_threads;
+	if (n == 0)
+	{
+		n = std::thread::hardware_concurrency();
+	}
+	for (unsigned int i = 1; i < n; i++)
+	{
+		workers.emplace_back(&Thread_Pool::worker_loop, this);
+	}
+}
+
+
+/**
+* Destructor that stops and joins every worker.
+*/
+Thread_Pool::~Thread_Pool()
+{
+	{
+		std::lock_guard<std::mutex> lock(state_mutex);
+		stopping = true;
+	}
+	work_ready.notify_all();
+	for (auto &w : workers)
+	{
+		w.join();
+	}
+}
+
+
+/**
+* Function to return the process wide pool, created on first use with one thread per hardware thread.
+*/
+Thread_Pool& Thread_Pool::shared()
+{
+	static Thread_Pool pool;
+	return pool;
+}
+
+
+/**
+* Function to run body over [0, n) split into chunks of at least grain items, on every thread of the pool.
+* Chunks are handed out dynamically so uneven work per item still balances. The call returns once every
+* chunk is done, and rethrows the first exception thrown by body (remaining chunks are then skipped).
+* @param n const size_t reference, denotes the number of items.
+* @param body const function reference, called as body(begin, end) on disjoint ranges covering [0, n).
+* @param grain const size_t reference, denotes the minimum number of items per chunk.
+*/
+void Thread_Pool::parallel_for(const std::size_t& n, const std::function<void(std::size_t begin, std::size_t end)>& body, const std::size_t& grain)
+{
+	if (n == 0)
+	{
+		return;
+	}
+	std::size_t min_chunk = grain > 0 ? grain : 1;
+	if (workers.empty() || inside_pool || n <= min_chunk)
+	{
+		body(0, n);
+		return;
+	}
+
+	std::lock_guard<std::mutex> submit(submit_mutex);
+	std::size_t target_chunks = 4 * (workers.size() + 1); // a few chunks per thread for load balancing
+	{
+		std::lock_guard<std::mutex> lock(state_mutex);
+		task = &body;
+		n_items = n;
+		chunk_size = (n + target_chunks - 1) / target_chunks;
+		if (chunk_size < min_chunk)
+		{
+			chunk_size = min_chunk;
+		}
+		next_item.store(0);
+		busy_workers = workers.size();
+		failure = nullptr;
+		generation++;
+	}
+	work_ready.notify_all();
+
+	inside_pool = true;
+	run_chunks();
+	inside_pool = false;
+
+	std::exception_ptr error;
+	{
+		std::unique_lock<std::mutex> lock(state_mutex);
+		work_done.wait(lock, [this] { return busy_workers == 0; });
+		task = nullptr;
+		error = failure;
+		failure = nullptr;
+	}
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+}
+
+
+/**
+* Function executed by each worker: wait for a new parallel_for, help with it, report back.
+*/
+void Thread_Pool::worker_loop()
+{
+	inside_pool = true;
+	unsigned long long seen = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(state_mutex);
+			work_ready.wait(lock, [this, &seen] { return stopping || generation != seen; });
+			if (stopping)
+			{
+				return;
+			}
+			seen = generation;
+		}
+
+		run_chunks();
+
+		{
+			std::lock_guard<std::mutex> lock(state_mutex);
+			busy_workers--;
+			if (busy_workers == 0)
+			{
+				work_done.notify_one();
+			}
+		}
+	}
+}
+
+
+/**
+* Function to claim and run chunks of the current parallel_for until none are left.
+*/
+void Thread_Pool::run_chunks()
+{
+	while (true)
+	{
+		std::size_t begin = next_item.fetch_add(chunk_size);
+		if (begin >= n_items)
+		{
+			return;
+		}
+		std::size_t end = begin + chunk_size < n_items ? begin + chunk_size : n_items;
+
+		try
+		{
+			(*task)(begin, end);
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(state_mutex);
+			if (!failure)
+			{
+				failure = std::current_exception();
+			}
+			next_item.store(n_items); // skip the remaining chunks
+		}
+	}
+}
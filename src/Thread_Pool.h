@@ -0,0 +1,53 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/**
+* Project:    Project 1
+* Filename:   Thread_Pool.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Persistent pool of worker threads for splitting independent pricing work across cores.
+*/
+class Thread_Pool
+{
+private:
+	// Attributes
+	std::vector<std::thread> workers;
+	std::mutex submit_mutex; // one parallel_for at a time
+	std::mutex state_mutex;
+	std::condition_variable work_ready;
+	std::condition_variable work_done;
+	const std::function<void(std::size_t, std::size_t)>* task{ nullptr };
+	std::size_t n_items{ 0 };
+	std::size_t chunk_size{ 1 };
+	std::atomic<std::size_t> next_item{ 0 };
+	std::size_t busy_workers{ 0 };
+	unsigned long long generation{ 0 };
+	bool stopping{ false };
+	std::exception_ptr failure;
+
+	// Methods
+	void worker_loop();
+	void run_chunks();
+
+
+public:
+	// Constructors & Destructor
+	Thread_Pool(const unsigned int& n_threads = 0); // 0 uses every hardware thread
+	~Thread_Pool();
+	Thread_Pool(const Thread_Pool&) = delete;
+	Thread_Pool& operator=(const Thread_Pool&) = delete;
+
+	// Methods
+	void parallel_for(const std::size_t& n, const std::function<void(std::size_t begin, std::size_t end)>& body, const std::size_t& grain = 1);
+	unsigned int get_thread_count() { return (unsigned int)(workers.size() + 1); }; // workers plus the calling thread
+	static Thread_Pool& shared(); // process wide pool sized to the machine
+};
@@ -0,0 +1,381 @@
+#include "Tick_Pricer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+
+/**
+* Project:    Project 1
+* Filename:   Tick_Pricer.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Tick-driven repricing loop: market updates arrive on a lock-free ring and a dedicated (optionally pinned) thread reprices the cap/floor books.
+*/
+
+
+namespace
+{
+	const std::size_t max_batch = 1024; // ticks coalesced into one repricing at most
+	const unsigned int spins_before_yield = 4096; // empty polls before the pricing thread gives up its time slice
+
+	inline void cpu_relax()
+	{
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+		_mm_pause();
+#endif
+	}
+
+	/**
+	* Function to restrict a thread to one CPU, returns false where this is not supported.
+	*/
+	bool pin_thread(std::thread& thread, const int& cpu)
+	{
+#if defined(__linux__)
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		return pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) == 0;
+#else
+		(void)thread;
+		(void)cpu;
+		return false;
+#endif
+	}
+
+	double percentile(const std::vector<std::int64_t>& sorted, const double& p)
+	{
+		std::size_t rank = std::size_t(std::ceil(p * sorted.size()));
+		return double(sorted[rank > 0 ? rank - 1 : 0]);
+	}
+}
+
+
+/**
+* Constructor for a repricing loop on one discount curve, the books are added with add_book before start.
+* @param zero_rates const vector double reference, denotes the zero rate at each pillar.
+* @param times const vector unsigned int reference, denotes the time (days) of each pillar.
+* @param continuous const bool reference, denotes whether the rates are continuously compounded.
+* @param freq const int reference, denotes the compounding frequency otherwise.
+* @param ring_capacity const size_t reference, denotes the number of ticks that can be pending.
+* @param max_samples const size_t reference, denotes the number of latencies recorded (later ticks are not measured).
+*/
+Tick_Pricer::Tick_Pricer(const std::vector<double>& zero_rates, const std::vector<unsigned int>& times, const bool& continuous, const int& freq, const std::size_t& ring_capacity, const std::size_t& max_samples)
+	: ring(ring_capacity)
+{
+	if (zero_rates.size() != times.size() || zero_rates.size() < 2)
+	{
+		throw 3; // Need at least one period.
+	}
+	rates = zero_rates;
+	time_of_rates = times;
+	continuous_compounding = continuous;
+	compounding_frequency = freq;
+	batch.resize(max_batch);
+	latencies.resize(max_samples);
+}
+
+
+/**
+* Destructor that stops the pricing thread.
+*/
+Tick_Pricer::~Tick_Pricer()
+{
+	stop();
+}
+
+
+/**
+* Function to add a book of optionlets on the pillars of the curve (optionlet i between pillars i and i+1).
+* @param strike_prices const vector double reference, denotes the strike of each optionlet.
+* @param vols const vector double reference, denotes the volatility of each optionlet.
+* Returns the index of the book, used by volatility and strike ticks.
+*/
+std::size_t Tick_Pricer::add_book(const std::vector<double>& strike_prices, const std::vector<double>& vols)
+{
+	if (is_running() || books.size() > UINT16_MAX)
+	{
+		throw 3; // The set of books is fixed while the pricing thread runs.
+	}
+	books.emplace_back(strike_prices, vols, rates, time_of_rates, continuous_compounding, compounding_frequency);
+	book_ticks.push_back(0);
+	return books.size() - 1;
+}
+
+
+/**
+* Function to publish the current prices and start the pricing thread.
+* @param cpu const int reference, denotes the CPU the pricing thread is pinned to (negative for no pinning).
+*/
+void Tick_Pricer::start(const int& cpu)
+{
+	if (is_running())
+	{
+		return;
+	}
+	quotes.reset(new Published_Quote[books.size()]);
+	for (std::size_t b = 0; b < books.size(); b++)
+	{
+		publish(b);
+	}
+
+	running.store(true, std::memory_order_release);
+	worker = std::thread(&Tick_Pricer::pricing_loop, this);
+	pinned = cpu >= 0 && pin_thread(worker, cpu);
+}
+
+
+/**
+* Function to stop the pricing thread once every tick already submitted has been priced.
+*/
+void Tick_Pricer::stop()
+{
+	if (!worker.joinable())
+	{
+		return;
+	}
+	running.store(false, std::memory_order_release);
+	worker.join();
+}
+
+
+/**
+* Function to forget the latencies recorded so far (e.g. after a warm up), while stopped.
+*/
+void Tick_Pricer::reset_latencies()
+{
+	if (!is_running())
+	{
+		latency_count = 0;
+	}
+}
+
+
+/**
+* Function to submit a tick to the pricing thread, stamping it with the current time (producer thread only).
+* @param tick Market_Tick, denotes the update.
+* Returns false if the ring is full, the tick is then not submitted.
+*/
+bool Tick_Pricer::submit(Market_Tick tick)
+{
+	tick.sent_ns = now_ns();
+	if (!ring.try_push(tick))
+	{
+		return false;
+	}
+	ticks_submitted++;
+	return true;
+}
+
+
+/**
+* Function to read the latest prices of a book, consistent with each other, from any thread.
+* @param book const size_t reference, denotes the book.
+* @param quote Book_Quote reference, filled with the prices.
+* Returns false if the book does not exist or the pricing thread was never started.
+*/
+bool Tick_Pricer::get_quote(const std::size_t& book, Book_Quote& quote)
+{
+	if (!quotes || book >= books.size())
+	{
+		return false;
+	}
+	Published_Quote& published = quotes[book];
+	while (true)
+	{
+		std::uint64_t before = published.version.load(std::memory_order_acquire);
+		if (before & 1)
+		{
+			cpu_relax();
+			continue;
+		}
+		quote.cap_price = published.cap_price.load(std::memory_order_relaxed);
+		quote.floor_price = published.floor_price.load(std::memory_order_relaxed);
+		quote.ticks_applied = published.ticks_applied.load(std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (published.version.load(std::memory_order_relaxed) == before)
+		{
+			return true;
+		}
+	}
+}
+
+
+/**
+* Function to return the steady clock time in nanoseconds, the time base of the tick stamps.
+*/
+std::int64_t Tick_Pricer::now_ns()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+/**
+* Function to summarise the recorded tick-to-price latencies (nanoseconds), while stopped.
+*/
+Latency_Summary Tick_Pricer::get_latency_summary()
+{
+	Latency_Summary summary{ 0, 0, 0, 0, 0, 0, 0 };
+	if (is_running() || latency_count == 0)
+	{
+		return summary;
+	}
+	std::vector<std::int64_t> sorted(latencies.begin(), latencies.begin() + latency_count);
+	std::sort(sorted.begin(), sorted.end());
+
+	double total = 0;
+	for (auto &l : sorted)
+	{
+		total += double(l);
+	}
+	summary.count = sorted.size();
+	summary.mean = total / sorted.size();
+	summary.p50 = percentile(sorted, 0.5);
+	summary.p90 = percentile(sorted, 0.9);
+	summary.p99 = percentile(sorted, 0.99);
+	summary.p999 = percentile(sorted, 0.999);
+	summary.max = double(sorted.back());
+	return summary;
+}
+
+
+/**
+* Function run by the pricing thread: price every pending batch, spinning (then yielding) while the ring is
+* empty. On stop the ticks still in the ring are priced before returning.
+*/
+void Tick_Pricer::pricing_loop()
+{
+	unsigned int idle = 0;
+	while (running.load(std::memory_order_acquire))
+	{
+		if (process_batch() > 0)
+		{
+			idle = 0;
+		}
+		else if (++idle < spins_before_yield)
+		{
+			cpu_relax();
+		}
+		else {
+			std::this_thread::yield();
+		}
+	}
+	while (process_batch() > 0)
+	{
+	}
+}
+
+
+/**
+* Function to apply every pending tick (up to max_batch), reprice the books once and record the latencies.
+* Returns the number of ticks taken from the ring.
+*/
+std::size_t Tick_Pricer::process_batch()
+{
+	std::size_t n = ring.pop_many(batch.data(), batch.size());
+	if (n == 0)
+	{
+		return 0;
+	}
+
+	std::size_t n_applied = 0;
+	for (std::size_t i = 0; i < n; i++)
+	{
+		if (apply(batch[i]))
+		{
+			batch[n_applied++] = batch[i];
+		}
+	}
+	for (std::size_t b = 0; b < books.size(); b++)
+	{
+		if (books[b].get_dirty_count() > 0)
+		{
+			books[b].reprice();
+			publish(b);
+		}
+	}
+
+	// Latency of each tick: from submission to its prices being visible to readers
+	std::int64_t priced = now_ns();
+	std::size_t n_recorded = std::min(n_applied, latencies.size() - latency_count);
+	for (std::size_t i = 0; i < n_recorded; i++)
+	{
+		latencies[latency_count + i] = priced - batch[i].sent_ns;
+	}
+	latency_count += n_recorded;
+
+	ticks_rejected.fetch_add(n - n_applied, std::memory_order_relaxed);
+	batches.fetch_add(1, std::memory_order_relaxed);
+	ticks_processed.fetch_add(n, std::memory_order_release);
+	return n;
+}
+
+
+/**
+* Function to apply one tick to the books, the values are checked here so a bad tick is dropped rather than
+* throwing on the pricing thread.
+* @param tick const Market_Tick reference, denotes the update.
+* Returns false if the tick was rejected.
+*/
+bool Tick_Pricer::apply(const Market_Tick& tick)
+{
+	if (!(tick.value > 0) || !std::isfinite(tick.value))
+	{
+		return false;
+	}
+	if (tick.type == Tick_Rate)
+	{
+		if (tick.index >= rates.size())
+		{
+			return false;
+		}
+		rates[tick.index] = tick.value;
+		for (std::size_t b = 0; b < books.size(); b++)
+		{
+			books[b].set_rate(tick.index, tick.value);
+			book_ticks[b]++;
+		}
+		return true;
+	}
+
+	if (tick.book >= books.size() || tick.index >= books[tick.book].size())
+	{
+		return false;
+	}
+	if (tick.type == Tick_Volatility)
+	{
+		books[tick.book].set_volatility(tick.index, tick.value);
+	}
+	else if (tick.type == Tick_Strike)
+	{
+		books[tick.book].set_strike(tick.index, tick.value);
+	}
+	else {
+		return false;
+	}
+	book_ticks[tick.book]++;
+	return true;
+}
+
+
+/**
+* Function to publish the prices of one book to the readers.
+* @param book const size_t reference, denotes the book.
+*/
+void Tick_Pricer::publish(const std::size_t& book)
+{
+	Published_Quote& published = quotes[book];
+	std::uint64_t version = published.version.load(std::memory_order_relaxed);
+	published.version.store(version + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	published.cap_price.store(books[book].get_cap_price(), std::memory_order_relaxed);
+	published.floor_price.store(books[book].get_floor_price(), std::memory_order_relaxed);
+	published.ticks_applied.store(book_ticks[book], std::memory_order_relaxed);
+	published.version.store(version + 2, std::memory_order_release);
+}
@@ -0,0 +1,136 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "Cap_Floor_Book.h"
+#include "Spsc_Ring.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Tick_Pricer.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Tick-driven repricing loop: market updates arrive on a lock-free ring and a dedicated (optionally pinned) thread reprices the cap/floor books.
+*
+* One producer thread submits ticks. The pricing thread drains every tick pending in the ring, applies them to the
+* books (several updates of the same pillar or optionlet only mark it dirty once), reprices the dirty optionlets of
+* each book once and publishes the totals, then records the tick-to-price latency of every tick of the batch.
+*/
+
+enum Tick_Type : unsigned char
+{
+	Tick_Rate = 0, // zero rate of a pillar, shared by every book
+	Tick_Volatility = 1, // volatility of an optionlet of one book
+	Tick_Strike = 2 // strike of an optionlet of one book
+};
+
+
+struct Market_Tick
+{
+	std::int64_t sent_ns; // steady clock time stamp (Tick_Pricer::now_ns) taken when the tick was submitted
+	std::uint32_t index; // pillar (Tick_Rate) or optionlet
+	std::uint16_t book; // ignored for Tick_Rate
+	Tick_Type type;
+	double value;
+};
+
+
+struct Book_Quote
+{
+	double cap_price;
+	double floor_price;
+	std::uint64_t ticks_applied; // ticks reflected in the prices
+};
+
+
+struct Latency_Summary
+{
+	std::size_t count; // ticks measured (nanoseconds below)
+	double mean;
+	double p50;
+	double p90;
+	double p99;
+	double p999;
+	double max;
+};
+
+
+class Tick_Pricer
+{
+private:
+	// Prices published by the pricing thread, read by any thread (sequence lock)
+	struct alignas(64) Published_Quote
+	{
+		std::atomic<std::uint64_t> version{ 0 }; // odd while being written
+		std::atomic<double> cap_price{ 0 };
+		std::atomic<double> floor_price{ 0 };
+		std::atomic<std::uint64_t> ticks_applied{ 0 };
+	};
+
+	// Attributes: market and books
+	std::vector<double> rates;
+	std::vector<unsigned int> time_of_rates;
+	bool continuous_compounding{ false };
+	int compounding_frequency{ 4 };
+	std::vector<Cap_Floor_Book> books;
+	std::vector<std::uint64_t> book_ticks; // ticks applied to each book
+
+	// Attributes: pricing thread
+	Spsc_Ring<Market_Tick> ring;
+	std::unique_ptr<Published_Quote[]> quotes;
+	std::vector<Market_Tick> batch;
+	std::vector<std::int64_t> latencies; // preallocated, filled up to max_samples
+	std::size_t latency_count{ 0 };
+	std::thread worker;
+	std::atomic<bool> running{ false };
+	std::atomic<std::uint64_t> ticks_processed{ 0 }; // applied or rejected
+	std::atomic<std::uint64_t> ticks_rejected{ 0 };
+	std::atomic<std::uint64_t> batches{ 0 };
+	std::uint64_t ticks_submitted{ 0 };
+	bool pinned{ false };
+
+	// Methods
+	void pricing_loop();
+	std::size_t process_batch();
+	bool apply(const Market_Tick& tick);
+	void publish(const std::size_t& book);
+
+
+public:
+	// Constructors & Destructor
+	Tick_Pricer(const std::vector<double>& zero_rates, const std::vector<unsigned int>& times, const bool& continuous, const int& freq = 4, const std::size_t& ring_capacity = 65536, const std::size_t& max_samples = 1 << 20);
+	~Tick_Pricer();
+	Tick_Pricer(const Tick_Pricer&) = delete;
+	Tick_Pricer& operator=(const Tick_Pricer&) = delete;
+
+	// Control Methods (books are added while stopped)
+	std::size_t add_book(const std::vector<double>& strike_prices, const std::vector<double>& vols);
+	void start(const int& cpu = -1);
+	void stop();
+	void reset_latencies();
+
+	// Producer Methods (one producer thread), return false if the ring is full
+	bool submit(Market_Tick tick);
+	bool submit_rate(const std::size_t& pillar, const double& rate) { return submit(Market_Tick{ 0, std::uint32_t(pillar), 0, Tick_Rate, rate }); };
+	bool submit_volatility(const std::size_t& book, const std::size_t& optionlet, const double& vol) { return submit(Market_Tick{ 0, std::uint32_t(optionlet), std::uint16_t(book), Tick_Volatility, vol }); };
+	bool submit_strike(const std::size_t& book, const std::size_t& optionlet, const double& strike) { return submit(Market_Tick{ 0, std::uint32_t(optionlet), std::uint16_t(book), Tick_Strike, strike }); };
+
+	// Reader Methods (any thread)
+	bool get_quote(const std::size_t& book, Book_Quote& quote);
+	static std::int64_t now_ns();
+
+	// Getter Methods (latencies and books are only read once stopped)
+	Latency_Summary get_latency_summary();
+	std::size_t get_book_count() { return books.size(); };
+	Cap_Floor_Book& get_book(const std::size_t& book) { return books.at(book); };
+	std::uint64_t get_ticks_submitted() { return ticks_submitted; };
+	std::uint64_t get_ticks_processed() { return ticks_processed.load(std::memory_order_acquire); };
+	std::uint64_t get_ticks_rejected() { return ticks_rejected.load(std::memory_order_relaxed); };
+	std::uint64_t get_batches() { return batches.load(std::memory_order_relaxed); };
+	bool is_running() { return running.load(std::memory_order_relaxed); };
+	bool is_pinned() { return pinned; }; // whether the last start managed to pin the pricing thread
+};
@@ -0,0 +1,134 @@
+#include "Tick_Replay.h"
+#include <cmath>
+#include <random>
+#include <thread>
+
+
+/**
+* Project:    Project 1
+* Filename:   Tick_Replay.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Generates a reproducible stream of rate and volatility ticks and replays it into a Tick_Pricer at a set rate, for offline latency testing.
+*/
+
+
+/**
+* Constructor for a tick generator on the curve and books of a Tick_Pricer.
+* @param zero_rates const vector double reference, denotes the starting zero rate of each pillar.
+* @param vols const vector double reference, denotes the starting volatility of each optionlet of a book.
+* @param books const size_t reference, denotes the number of books volatility ticks are spread over.
+* @param vol_fraction const double reference, denotes the fraction of the ticks that are volatility updates.
+* @param seed_value const uint64 reference, denotes the seed of the generator.
+*/
+Tick_Replay::Tick_Replay(const std::vector<double>& zero_rates, const std::vector<double>& vols, const std::size_t& books, const double& vol_fraction, const std::uint64_t& seed_value)
+{
+	if (zero_rates.empty() || (vol_fraction > 0 && (vols.empty() || books == 0)))
+	{
+		throw 3; // Nothing to update.
+	}
+	for (auto &v : zero_rates)
+	{
+		if (!(v > 0))
+		{
+			throw 2;
+		}
+	}
+	for (auto &v : vols)
+	{
+		if (!(v > 0))
+		{
+			throw 2;
+		}
+	}
+	start_rates = zero_rates;
+	start_vols = vols;
+	n_books = books;
+	vol_share = vol_fraction;
+	seed = seed_value;
+}
+
+
+/**
+* Function to generate the tick stream, replacing any previous one. Each tick moves one rate (or volatility):
+* its log deviation x from the starting value steps by -reversion x + step z, so the curve keeps its shape (and
+* its forwards stay positive) however long the stream.
+* @param n_ticks const size_t reference, denotes the number of ticks.
+* @param rate_step const double reference, denotes the standard deviation of the log step of a rate.
+* @param vol_step const double reference, denotes the standard deviation of the log step of a volatility.
+* @param reversion const double reference, denotes the fraction of the deviation removed at each step.
+*/
+void Tick_Replay::generate(const std::size_t& n_ticks, const double& rate_step, const double& vol_step, const double& reversion)
+{
+	std::mt19937_64 generator(seed);
+	std::uniform_real_distribution<double> uniform(0., 1.);
+	std::normal_distribution<double> normal(0., 1.);
+	std::vector<double> rate_shifts(start_rates.size(), 0.); // log deviations from the starting values
+	std::vector<double> vol_shifts(n_books * start_vols.size(), 0.);
+
+	ticks.resize(n_ticks);
+	for (auto &tick : ticks)
+	{
+		tick.sent_ns = 0;
+		if (uniform(generator) < vol_share)
+		{
+			std::size_t slot = std::size_t(uniform(generator) * vol_shifts.size()) % vol_shifts.size();
+			vol_shifts[slot] += vol_step * normal(generator) - reversion * vol_shifts[slot];
+			tick.type = Tick_Volatility;
+			tick.book = std::uint16_t(slot / start_vols.size());
+			tick.index = std::uint32_t(slot % start_vols.size());
+			tick.value = start_vols[tick.index] * exp(vol_shifts[slot]);
+		}
+		else {
+			std::size_t pillar = std::size_t(uniform(generator) * rate_shifts.size()) % rate_shifts.size();
+			rate_shifts[pillar] += rate_step * normal(generator) - reversion * rate_shifts[pillar];
+			tick.type = Tick_Rate;
+			tick.book = 0;
+			tick.index = std::uint32_t(pillar);
+			tick.value = start_rates[pillar] * exp(rate_shifts[pillar]);
+		}
+	}
+}
+
+
+/**
+* Function to submit the generated ticks to a running pricer, evenly spaced in time, then wait until the pricing
+* thread has priced all of them. Must be called from the pricer's producer thread.
+* @param pricer Tick_Pricer reference, denotes the started pricer.
+* @param ticks_per_second const double reference, denotes the submission rate (0 submits as fast as possible).
+*/
+Replay_Report Tick_Replay::replay(Tick_Pricer& pricer, const double& ticks_per_second)
+{
+	Replay_Report report{ 0, 0, 0, 0 };
+	if (!pricer.is_running())
+	{
+		return report;
+	}
+	double interval = ticks_per_second > 0 ? 1e9 / ticks_per_second : 0;
+	std::uint64_t target = pricer.get_ticks_processed();
+	std::int64_t begin = Tick_Pricer::now_ns();
+
+	for (std::size_t i = 0; i < ticks.size(); i++)
+	{
+		std::int64_t due = begin + std::int64_t(i * interval);
+		while (interval > 0 && Tick_Pricer::now_ns() < due)
+		{
+			std::this_thread::yield(); // lets the pricing thread run when it shares the core
+		}
+		while (!pricer.submit(ticks[i]))
+		{
+			report.ring_full_retries++;
+			std::this_thread::yield();
+		}
+		report.ticks_sent++;
+	}
+
+	target += report.ticks_sent;
+	while (pricer.get_ticks_processed() < target)
+	{
+		std::this_thread::yield();
+	}
+	report.seconds = (Tick_Pricer::now_ns() - begin) * 1e-9;
+	report.ticks_per_second = report.seconds > 0 ? report.ticks_sent / report.seconds : 0;
+	return report;
+}
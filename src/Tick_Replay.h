@@ -0,0 +1,51 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "Tick_Pricer.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Tick_Replay.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Generates a reproducible stream of rate and volatility ticks and replays it into a Tick_Pricer at a set rate, for offline latency testing.
+*
+* Rates and volatilities follow mean-reverting lognormal walks around their starting values, so every tick is valid.
+*/
+
+struct Replay_Report
+{
+	std::size_t ticks_sent;
+	std::size_t ring_full_retries; // submissions retried because the pricing thread had fallen behind
+	double seconds; // from the first submission until the last tick was priced
+	double ticks_per_second;
+};
+
+
+class Tick_Replay
+{
+private:
+	// Attributes
+	std::vector<Market_Tick> ticks;
+	std::vector<double> start_rates;
+	std::vector<double> start_vols; // volatility of each optionlet, the same for every book
+	std::size_t n_books;
+	double vol_share; // fraction of the ticks that are volatility updates
+	std::uint64_t seed;
+
+
+public:
+	// Constructor & Destructor
+	Tick_Replay(const std::vector<double>& zero_rates, const std::vector<double>& vols, const std::size_t& books = 1, const double& vol_fraction = 0.3, const std::uint64_t& seed_value = 42);
+	~Tick_Replay() {};
+
+	// Methods
+	void generate(const std::size_t& n_ticks, const double& rate_step = 0.001, const double& vol_step = 0.005, const double& reversion = 0.05);
+	Replay_Report replay(Tick_Pricer& pricer, const double& ticks_per_second = 0);
+
+	// Getter Methods
+	std::size_t size() { return ticks.size(); };
+	const std::vector<Market_Tick>& get_ticks() { return ticks; };
+};
@@ -0,0 +1,181 @@
+#include "Vol_Calibration.h"
+#include <cmath>
+#include <functional>
+
+
+/**
+* Project:    Project 1
+* Filename:   Vol_Calibration.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Calibration context remembering the implied volatility of each optionlet across successive quote ticks.
+*/
+
+
+/**
+* Function to hash a (strike, expiry, call) key.
+* @param key const Vol_Key reference, denotes the optionlet.
+*/
+std::size_t Vol_Key_Hash::operator()(const Vol_Key& key) const
+{
+	std::size_t h = std::hash<double>()(key.strike);
+	h ^= std::hash<double>()(key.expiry) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+	return h ^ std::size_t(key.call);
+}
+
+
+/**
+* Constructor for an empty calibration context.
+* @param price_tol const double reference, denotes the largest price move for which a cached result is returned.
+* @param rate_tol const double reference, denotes the largest forward rate or discount factor move for which a cached result is returned.
+* @param solver_tol const double reference, denotes the absolute error allowed on the option price by the solver.
+* @param max_entries const size_t reference, denotes the largest number of optionlets cached (at least one).
+*/
+Vol_Calibration::Vol_Calibration(const double& price_tol, const double& rate_tol, const double& solver_tol, const std::size_t& max_entries)
+{
+	if (max_entries == 0)
+	{
+		throw 2;
+	}
+	price_tolerance = price_tol;
+	rate_tolerance = rate_tol;
+	solver_tolerance = solver_tol;
+	capacity = max_entries;
+}
+
+
+/**
+* Function to infer the volatility of a caplet (call = true) or floorlet (call = false) from its price,
+* remembering the result per (strike, expiry). If the price, forward and discount factor have moved by
+* less than the tolerances since the last solve of the same optionlet, the cached result is returned
+* without any Black evaluation. Otherwise a converged previous volatility seeds the Halley steps
+* (see Implied_Volatility::solve_from), and a new optionlet is solved from scratch. A non-finite strike or
+* expiry is solved without being cached.
+* @param option_price const double reference, denotes the fair price of the option.
+* @param forward const double reference, denotes the forward rate.
+* @param strike const double reference, denotes the strike of the option.
+* @param t_1 const double reference, denotes the time (days) at which the rate is set.
+* @param discount const double reference, denotes the ZCB price at the payment date.
+* @param call const boolean reference, denotes whether the option is a caplet(true) or floorlet(false).
+*/
+Vol_Result Vol_Calibration::solve(const double& option_price, const double& forward, const double& strike, const double& t_1, const double& discount, const bool& call)
+{
+	solves++;
+	if (!std::isfinite(strike) || !std::isfinite(t_1))
+	{
+		// A NaN key never equals itself, so it could never be looked up or evicted: solve it uncached
+		Vol_Result result = Implied_Volatility::solve(option_price, forward, strike, t_1, discount, call, solver_tolerance);
+		cold_starts++;
+		iterations += result.iterations;
+		return result;
+	}
+
+	Vol_Key key{ strike, t_1, call };
+	auto found = slot_of.find(key);
+	if (found == slot_of.end())
+	{
+		Vol_Result result = Implied_Volatility::solve(option_price, forward, strike, t_1, discount, call, solver_tolerance);
+		cold_starts++;
+		iterations += result.iterations;
+		entries[insert_slot(key)] = Vol_Entry{ key, option_price, forward, discount, result, false };
+		return result;
+	}
+
+	Vol_Entry& entry = entries[found->second];
+	entry.referenced = true;
+	if (fabs(option_price - entry.option_price) <= price_tolerance && fabs(forward - entry.forward) <= rate_tolerance && fabs(discount - entry.discount) <= rate_tolerance)
+	{
+		cache_hits++;
+		return entry.result;
+	}
+
+	if (entry.result.status == Vol_Converged)
+	{
+		entry.result = Implied_Volatility::solve_from(option_price, forward, strike, t_1, discount, call, entry.result.volatility, solver_tolerance);
+		warm_starts++;
+	}
+	else {
+		entry.result = Implied_Volatility::solve(option_price, forward, strike, t_1, discount, call, solver_tolerance);
+		cold_starts++;
+	}
+	iterations += entry.result.iterations;
+	entry.option_price = option_price;
+	entry.forward = forward;
+	entry.discount = discount;
+	return entry.result;
+}
+
+
+/**
+* Function to find the slot of a new optionlet: the next free one while the cache is below capacity,
+* otherwise the first entry the clock hand finds not looked up since its last pass, which is evicted.
+* @param key const Vol_Key reference, denotes the optionlet to be cached.
+* Returns the position in entries, to be overwritten by the caller.
+*/
+std::size_t Vol_Calibration::insert_slot(const Vol_Key& key)
+{
+	std::size_t slot;
+	if (entries.size() < capacity)
+	{
+		slot = entries.size();
+		entries.emplace_back();
+	}
+	else {
+		while (entries[clock_hand].referenced)
+		{
+			entries[clock_hand].referenced = false;
+			clock_hand = clock_hand + 1 < capacity ? clock_hand + 1 : 0;
+		}
+		slot = clock_hand;
+		clock_hand = clock_hand + 1 < capacity ? clock_hand + 1 : 0;
+		slot_of.erase(entries[slot].key);
+		evictions++;
+	}
+	slot_of.emplace(key, slot);
+	return slot;
+}
+
+
+/**
+* Function to infer the volatilities of n optionlets from their prices (see solve).
+* @param prices const double pointer, denotes the fair price of each optionlet.
+* @param forward const double pointer, denotes the forward rate of each optionlet.
+* @param strike const double pointer, denotes the strike of each optionlet.
+* @param t_1 const double pointer, denotes the time (days) at which each optionlet's rate is set.
+* @param discount const double pointer, denotes the ZCB price at the payment date of each optionlet.
+* @param n const size_t reference, denotes the number of optionlets.
+* @param call const boolean reference, denotes whether the optionlets are caplets(true) or floorlets(false).
+* @param results Vol_Result pointer, denotes the output array of results (one per optionlet).
+*/
+void Vol_Calibration::solve_batch(const double* prices, const double* forward, const double* strike, const double* t_1, const double* discount, const std::size_t& n, const bool& call, Vol_Result* results)
+{
+	for (std::size_t i = 0; i < n; i++)
+	{
+		results[i] = solve(prices[i], forward[i], strike[i], t_1[i], discount[i], call);
+	}
+}
+
+
+/**
+* Function to forget every cached volatility (e.g. after a market jump), the statistics are kept.
+*/
+void Vol_Calibration::clear()
+{
+	slot_of.clear();
+	entries.clear();
+	clock_hand = 0;
+}
+
+
+/**
+* Function to reset the hit and iteration statistics.
+*/
+void Vol_Calibration::reset_statistics()
+{
+	solves = 0;
+	cache_hits = 0;
+	warm_starts = 0;
+	cold_starts = 0;
+	iterations = 0;
+	evictions = 0;
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <unordered_map>
+#include "Implied_Volatility.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Vol_Calibration.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Calibration context remembering the implied volatility of each optionlet across successive quote ticks.
+*
+* One context per thread: lookups and statistics are not synchronised. The cache holds at most a fixed number
+* of optionlets (default_capacity unless given), beyond which a new optionlet replaces one not looked up since
+* the clock hand last passed it, so a stream whose strikes or expiries keep moving cannot grow it without bound.
+*/
+
+struct Vol_Key
+{
+	double strike;
+	double expiry; // t_1 (days)
+	bool call;
+
+	bool operator==(const Vol_Key& other) const { return strike == other.strike && expiry == other.expiry && call == other.call; };
+};
+
+struct Vol_Key_Hash
+{
+	std::size_t operator()(const Vol_Key& key) const;
+};
+
+
+class Vol_Calibration
+{
+private:
+	struct Vol_Entry
+	{
+		Vol_Key key;
+		double option_price; // inputs of the last solve
+		double forward;
+		double discount;
+		Vol_Result result;
+		bool referenced; // looked up since the clock hand last passed
+	};
+
+	// Attributes
+	std::unordered_map<Vol_Key, std::size_t, Vol_Key_Hash> slot_of; // position of each cached optionlet in entries
+	std::vector<Vol_Entry> entries; // at most capacity entries
+	std::size_t capacity;
+	std::size_t clock_hand{ 0 };
+	double price_tolerance; // inputs moving less than these return the cached result
+	double rate_tolerance;
+	double solver_tolerance;
+
+	// Statistics
+	std::size_t solves{ 0 };
+	std::size_t cache_hits{ 0 };
+	std::size_t warm_starts{ 0 };
+	std::size_t cold_starts{ 0 };
+	std::size_t iterations{ 0 }; // Black evaluations made by the solver
+	std::size_t evictions{ 0 };
+
+	std::size_t insert_slot(const Vol_Key& key);
+
+
+public:
+	static constexpr std::size_t default_capacity = 65536; // optionlets cached, under 10 MB with the index
+
+	// Constructor & Destructor
+	Vol_Calibration(const double& price_tol = Implied_Volatility::default_tolerance, const double& rate_tol = 1e-12, const double& solver_tol = Implied_Volatility::default_tolerance, const std::size_t& max_entries = default_capacity);
+	~Vol_Calibration() {};
+
+	// Methods
+	Vol_Result solve(const double& option_price, const double& forward, const double& strike, const double& t_1, const double& discount, const bool& call);
+	void solve_batch(const double* prices, const double* forward, const double* strike, const double* t_1, const double* discount, const std::size_t& n, const bool& call, Vol_Result* results);
+	void clear();
+	void reset_statistics();
+
+	// Getter Methods
+	std::size_t size() { return entries.size(); };
+	std::size_t get_capacity() { return capacity; };
+	std::size_t get_evictions() { return evictions; };
+	std::size_t get_solves() { return solves; };
+	std::size_t get_cache_hits() { return cache_hits; };
+	std::size_t get_warm_starts() { return warm_starts; };
+	std::size_t get_cold_starts() { return cold_starts; };
+	std::size_t get_iterations() { return iterations; };
+	double get_hit_rate() { return solves ? double(cache_hits) / solves : 0.; };
+	double get_average_iterations() { return solves ? double(iterations) / solves : 0.; };
+};
@@ -0,0 +1,107 @@
+#include "Vol_Surface.h"
+#include "Optionlet_Batch.h"
+#include "Batch_Validation.h"
+#include <iostream>
+#include <limits>
+
+
+/**
+* Project:    Project 1
+* Filename:   Vol_Surface.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Strike x expiry implied volatility surface inverted from caplet or floorlet prices in parallel.
+*/
+
+
+/**
+* Constructor for an implied volatility surface. Expiry j is the period between the zero rates
+* rates[j] and rates[j+1] (as for the caplets of a Rate_Cap), and every (strike, expiry) cell is
+* inverted independently on the threads of the pool. Bad quotes or unusable pillars are flagged
+* per cell in the results (NaN volatility) rather than thrown, so the rest of the surface is kept.
+* @param strikes const vector double reference, denotes the strikes (rows) of the surface.
+* @param prices const vector double reference, denotes the option prices, row-major [strike][expiry].
+* @param rates const vector double reference, denotes the zero rates at each pillar (N+1 for N expiries).
+* @param time_of_rates const vector usigned int reference, denotes the times at which each of the rates occurs.
+* @param call const boolean reference, denotes whether the prices are of caplets(true) or floorlets(false).
+* @param continuous const boolean reference, denotes whether interest is continuously(true) or discretely(false) compounded.
+* @param pool Thread_Pool reference, denotes the threads used for the inversion.
+*/
+Vol_Surface::Vol_Surface(const std::vector<double>& strikes, const std::vector<double>& prices, const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const bool& call, const bool& continuous, Thread_Pool& pool)
+{
+	if (rates.size() < 2 || time_of_rates.size() != rates.size() || prices.size() != strikes.size() * (rates.size() - 1))
+	{
+		throw 3; // The shape of the grid itself is wrong, no cell can be attributed to an expiry.
+	}
+
+	n_strikes = strikes.size();
+	n_expiries = rates.size() - 1;
+	call_options = call;
+	surface_strikes = strikes;
+	forward_rates.assign(n_expiries, 0);
+	expiries.assign(n_expiries, 0);
+	discount_factors.assign(n_expiries, 0);
+	valid_expiries.assign(n_expiries, false);
+
+	// Forward rate and discount factor per expiry column, unusable columns are flagged instead of thrown
+	for (std::size_t j = 0; j < n_expiries; j++)
+	{
+		if (Batch_Validation::validate_curve(&rates[j], &time_of_rates[j], 2, 4, continuous) == Input_Valid)
+		{
+			Optionlet_Batch::forward_curve(&rates[j], &time_of_rates[j], 2, continuous, 4, &forward_rates[j], &expiries[j], &discount_factors[j]);
+			valid_expiries[j] = true;
+		}
+	}
+
+	volatilities.assign(prices.size(), std::numeric_limits<double>::quiet_NaN());
+	results.assign(prices.size(), Vol_Result{ std::numeric_limits<double>::quiet_NaN(), 0, Vol_Invalid_Input });
+
+	pool.parallel_for(prices.size(), [&](std::size_t begin, std::size_t end)
+	{
+		for (std::size_t cell = begin; cell < end; cell++)
+		{
+			std::size_t i = cell / n_expiries;
+			std::size_t j = cell % n_expiries;
+			if (valid_expiries[j])
+			{
+				results[cell] = Implied_Volatility::solve(prices[cell], forward_rates[j], surface_strikes[i], expiries[j], discount_factors[j], call_options);
+				volatilities[cell] = results[cell].volatility;
+			}
+		}
+	}, 64);
+}
+
+
+/**
+* Function to count the cells whose inversion did not converge.
+*/
+std::size_t Vol_Surface::get_failure_count()
+{
+	std::size_t failures = 0;
+	for (auto &r : results)
+	{
+		if (r.status != Vol_Converged)
+		{
+			failures++;
+		}
+	}
+	return failures;
+}
+
+
+/**
+* Function to print the surface to the console, one strike per line.
+*/
+void Vol_Surface::print_volatilities()
+{
+	for (std::size_t i = 0; i < n_strikes; i++)
+	{
+		std::cout << "Strike " << surface_strikes[i] << " Volatilities: ";
+		for (std::size_t j = 0; j < n_expiries; j++)
+		{
+			std::cout << volatilities[i * n_expiries + j] << " ";
+		}
+		std::cout << std::endl;
+	}
+	return;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include "Implied_Volatility.h"
+#include "Thread_Pool.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Vol_Surface.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Strike x expiry implied volatility surface inverted from caplet or floorlet prices in parallel.
+*/
+class Vol_Surface
+{
+private:
+	// Attributes
+	std::size_t n_strikes;
+	std::size_t n_expiries;
+	bool call_options;
+	std::vector<double> surface_strikes;
+	std::vector<double> forward_rates; // one per expiry
+	std::vector<double> expiries; // t_1 of each expiry (days)
+	std::vector<double> discount_factors; // ZCB price at t_2 of each expiry
+	std::vector<bool> valid_expiries; // false when the rates or times bounding the expiry are unusable
+	std::vector<double> volatilities; // row-major, [strike][expiry]
+	std::vector<Vol_Result> results; // row-major, [strike][expiry]
+
+
+public:
+	// Constructor & Destructor
+	Vol_Surface(const std::vector<double>& strikes, const std::vector<double>& prices, const std::vector<double>& rates, const std::vector<unsigned int>& time_of_rates, const bool& call, const bool& continuous, Thread_Pool& pool = Thread_Pool::shared());
+	~Vol_Surface() {};
+
+	// Getter & Print Methods
+	const std::vector<double>& get_volatilities() { return volatilities; };
+	const std::vector<Vol_Result>& get_results() { return results; };
+	double get_volatility(const std::size_t& strike_index, const std::size_t& expiry_index) { return volatilities.at(strike_index * n_expiries + expiry_index); };
+	Vol_Status get_status(const std::size_t& strike_index, const std::size_t& expiry_index) { return results.at(strike_index * n_expiries + expiry_index).status; };
+	std::size_t get_failure_count();
+	std::size_t get_strike_count() { return n_strikes; };
+	std::size_t get_expiry_count() { return n_expiries; };
+	void print_volatilities();
+};
@@ -0,0 +1,215 @@
+#include "Yield_Solver.h"
+#include "Bond_Book.h"
+#include "Hot_Path_Counters.h"
+#include <cmath>
+#include <limits>
+
+
+/**
+* Project:    Project 1
+* Filename:   Yield_Solver.cpp
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Silent, bounded Halley solver for the yields to maturity of many bonds at once.
+*/
+
+
+namespace
+{
+	/**
+	* Function to compute the value of a set of cashflows at yield y, with its first and second derivatives
+	* w.r.t. y, in one pass (see Bond::get_price_at_yield).
+	*/
+	inline double value_at_yield(const double* amounts, const double* times, const std::size_t& n, const double& y, double& d_value, double& d2_value)
+	{
+		double value = 0;
+		d_value = 0;
+		d2_value = 0;
+		for (std::size_t i = 0; i < n; i++)
+		{
+			double t = times[i] / 365.;
+			double pv = amounts[i] * exp(-1 * y * t);
+			value += pv;
+			d_value -= t * pv;
+			d2_value += t * t * pv;
+		}
+		return value;
+	}
+}
+
+
+/**
+* Function to infer the yield to maturity of a bond from its price. The price of a bond with non-negative
+* cashflows is a decreasing convex function of the yield, so Halley steps from a duration based guess
+* converge in a few evaluations. The root is kept inside a bracket, narrowed after every evaluation, and
+* steps leaving it are replaced by bisection. Nothing is printed, failures are reported in the result.
+* @param amounts const double pointer, denotes the cashflows of the bond (principal included).
+* @param times const double pointer, denotes the time (days) of each cashflow.
+* @param n_cashflows const size_t reference, denotes the number of cashflows.
+* @param price const double reference, denotes the price of the bond.
+* @param tolerance const double reference, denotes the fractional error allowed on the bond price.
+*/
+Yield_Result Yield_Solver::solve_uncounted(const double* amounts, const double* times, const std::size_t& n_cashflows, const double& price, const double& tolerance)
+{
+	Yield_Result result{ std::numeric_limits<double>::quiet_NaN(), 0, Yield_Invalid_Input };
+
+	double total = 0;
+	double weighted_time = 0;
+	for (std::size_t i = 0; i < n_cashflows; i++)
+	{
+		if (!(amounts[i] >= 0) || !std::isfinite(amounts[i]) || !(times[i] >= 0) || !std::isfinite(times[i]))
+		{
+			return result;
+		}
+		total += amounts[i];
+		weighted_time += amounts[i] * times[i] / 365.;
+	}
+	if (!(total > 0) || !(price > 0) || !std::isfinite(price))
+	{
+		return result;
+	}
+
+	// First order guess: price = total exp(-y * average payment time)
+	double average_time = weighted_time / total;
+	double y = average_time > 0 ? log(total / price) / average_time : 0.;
+	if (!(y > min_yield && y < max_yield))
+	{
+		y = 0.5 * (min_yield + max_yield);
+	}
+
+	double lower = min_yield;
+	double upper = max_yield;
+	bool lower_checked = false; // whether the value at the bracket end has been seen
+	bool upper_checked = false;
+
+	while (result.iterations < max_iterations)
+	{
+		double d_value, d2_value;
+		double error = value_at_yield(amounts, times, n_cashflows, y, d_value, d2_value) - price;
+		result.iterations++;
+
+		if (fabs(error) <= tolerance * price)
+		{
+			result.yield = y;
+			result.status = Yield_Converged;
+			return result;
+		}
+
+		// Value decreases with yield: a positive error means the root lies above y
+		if (error > 0)
+		{
+			lower = y;
+			lower_checked = true;
+		}
+		else {
+			upper = y;
+			upper_checked = true;
+		}
+
+		double denominator = 2 * d_value * d_value - error * d2_value;
+		double y_new = denominator != 0 ? y - 2 * error * d_value / denominator : lower - 1;
+		if (!(y_new > lower && y_new < upper))
+		{
+			y_new = 0.5 * (lower + upper);
+		}
+		if (fabs(y_new - y) <= std::numeric_limits<double>::epsilon() * (1 + fabs(y)))
+		{
+			result.yield = y_new;
+			result.status = Yield_Converged; // bracket collapsed onto the root
+			return result;
+		}
+		y = y_new;
+	}
+
+	// Classify failures at the ends of the search interval, otherwise return the best estimate
+	double d_value, d2_value;
+	if (!lower_checked && value_at_yield(amounts, times, n_cashflows, min_yield, d_value, d2_value) < price)
+	{
+		result.status = Yield_Below_Minimum;
+	}
+	else if (!upper_checked && value_at_yield(amounts, times, n_cashflows, max_yield, d_value, d2_value) > price)
+	{
+		result.status = Yield_Above_Maximum;
+	}
+	else {
+		result.yield = y;
+		result.status = Yield_Max_Iterations;
+	}
+	return result;
+}
+
+
+/**
+* Function to infer the yield to maturity of a bond from its price and count the call (see solve_uncounted).
+* Parameters as for solve_uncounted.
+*/
+Yield_Result Yield_Solver::solve(const double* amounts, const double* times, const std::size_t& n_cashflows, const double& price, const double& tolerance)
+{
+	Yield_Result result = solve_uncounted(amounts, times, n_cashflows, price, tolerance);
+	Hot_Path_Counters::record(Counter_Yield, result.iterations, result.status != Yield_Converged || std::isnan(result.yield),
+		result.status == Yield_Below_Minimum || result.status == Yield_Above_Maximum);
+	return result;
+}
+
+
+/**
+* Function to solve the yields of many bonds stored back to back in contiguous arrays, on the threads of the pool.
+* @param amounts const double pointer, denotes the cashflows of every bond.
+* @param times const double pointer, denotes the time (days) of every cashflow.
+* @param offsets const size_t pointer, denotes where the cashflows of each bond start (n_bonds + 1 entries).
+* @param n_bonds const size_t reference, denotes the number of bonds.
+* @param prices const double pointer, denotes the price of each bond.
+* @param results Yield_Result pointer, denotes the output array of results (one per bond).
+* @param pool Thread_Pool reference, denotes the threads used for solving.
+*/
+void Yield_Solver::solve_batch(const double* amounts, const double* times, const std::size_t* offsets, const std::size_t& n_bonds, const double* prices, Yield_Result* results, Thread_Pool& pool)
+{
+	pool.parallel_for(n_bonds, [&](std::size_t begin, std::size_t end)
+	{
+		for (std::size_t b = begin; b < end; b++)
+		{
+			results[b] = solve(amounts + offsets[b], times + offsets[b], offsets[b + 1] - offsets[b], prices[b]);
+		}
+	}, 256);
+}
+
+
+/**
+* Function to solve the yields of a portfolio of bonds. The cashflows of every bond are first copied
+* into a flat cashflow table (see Bond_Book.cpp) and then solved with solve_batch.
+* @param bonds vector Bond reference, denotes the bonds of the portfolio.
+* @param prices const vector double reference, denotes the price of each bond.
+* @param results vector Yield_Result reference, resized and filled with the outcome of each solve.
+* @param pool Thread_Pool reference, denotes the threads used for solving.
+*/
+void Yield_Solver::solve_portfolio(std::vector<Bond>& bonds, const std::vector<double>& prices, std::vector<Yield_Result>& results, Thread_Pool& pool)
+{
+	if (prices.size() != bonds.size())
+	{
+		throw 3; // Check each bond has a corresponding price.
+	}
+
+	Bond_Book book;
+	for (auto &b : bonds)
+	{
+		book.add_bond(b);
+	}
+	book.solve_yields(prices, results, pool);
+}
+
+
+/**
+* Function to return a printable description of a solver status.
+* @param status const Yield_Status reference, denotes the outcome of a solve.
+*/
+const char* Yield_Solver::get_status_name(const Yield_Status& status)
+{
+	switch (status)
+	{
+	case Yield_Converged: return "converged";
+	case Yield_Max_Iterations: return "maximum iterations reached";
+	case Yield_Below_Minimum: return "price above value at minimum yield";
+	case Yield_Above_Maximum: return "price below value at maximum yield";
+	default: return "invalid input";
+	}
+}
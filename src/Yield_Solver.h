@@ -0,0 +1,55 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include "Bond.h"
+#include "Thread_Pool.h"
+
+
+/**
+* Project:    Project 1
+* Filename:   Yield_Solver.h
+* Version:    v1 (17 October 2026)
+* Author:     Ryan Sephton
+* Summary:    Silent, bounded Halley solver for the yields to maturity of many bonds at once.
+*/
+
+enum Yield_Status
+{
+	Yield_Converged = 0, // price recovered to within the tolerance
+	Yield_Max_Iterations = 1, // iteration cap reached, best estimate returned
+	Yield_Below_Minimum = 2, // price above the value at the minimum yield, NaN returned
+	Yield_Above_Maximum = 3, // price below the value at the maximum yield, NaN returned
+	Yield_Invalid_Input = 4 // no cashflows, negative or non-finite cashflows, or non-positive price, NaN returned
+};
+
+struct Yield_Result
+{
+	double yield;
+	int iterations; // number of price evaluations
+	Yield_Status status;
+};
+
+
+class Yield_Solver
+{
+private:
+	// Solver body, counted by solve (see Hot_Path_Counters.h)
+	static Yield_Result solve_uncounted(const double* amounts, const double* times, const std::size_t& n_cashflows, const double& price, const double& tolerance);
+
+public:
+	// Search interval and limits (continuously compounded yields, as in Bond::get_price_at_yield)
+	static constexpr double min_yield = -1.;
+	static constexpr double max_yield = 5.;
+	static constexpr double default_tolerance = 0.000000001; // fractional error on the bond price
+	static constexpr int max_iterations = 32;
+
+	// Solver for one bond, cashflow amounts paid at times (days)
+	static Yield_Result solve(const double* amounts, const double* times, const std::size_t& n_cashflows, const double& price, const double& tolerance = default_tolerance);
+
+	// Solvers for many bonds, bond b owns cashflows [offsets[b], offsets[b+1])
+	static void solve_batch(const double* amounts, const double* times, const std::size_t* offsets, const std::size_t& n_bonds, const double* prices, Yield_Result* results, Thread_Pool& pool = Thread_Pool::shared());
+	static void solve_portfolio(std::vector<Bond>& bonds, const std::vector<double>& prices, std::vector<Yield_Result>& results, Thread_Pool& pool = Thread_Pool::shared());
+
+	// Reporting
+	static const char* get_status_name(const Yield_Status& status);
+};